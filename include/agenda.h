@@ -0,0 +1,220 @@
+#ifndef AGENDA_H
+#define AGENDA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "flash.h"
+
+// Agendador cooperativo sobre uma roda de tempo: cada tarefa agendada fica
+// na lista do slot (prazo >> AGENDA_TICK_SHIFT) & (Slots - 1), então
+// executar() só olha os slots dos ticks que passaram, não todas as
+// tarefas. As vencidas rodam em ordem de prazo. O tempo é em us (micros()),
+// com diferenças em 32 bits para atravessar a virada do contador.
+//
+// executar() devolve quanto falta para o próximo prazo; o sketch usa isso
+// para dormir até lá (ou até uma interrupção).
+//
+// O nome de cada tarefa fica na flash: agenda.periodica(PSTR("sonar"), ...).
+
+#define AGENDA_TICK_SHIFT 10          // tick da roda de ~1 ms
+#define AGENDA_ESPERA_MAX 1000000UL   // sem tarefas: acordar a cada 1 s
+#define AGENDA_NENHUMA 0xFF
+
+struct Tarefa {
+  const char* nome;      // PROGMEM
+  void (*funcao)();
+  uint32_t periodo;      // us; 0 = tarefa única
+  uint32_t prazo;
+  uint8_t proxima;       // próxima na lista do slot
+  uint8_t estado;
+
+  // Atraso entre o prazo e o início da execução, desde o último zerar
+  uint32_t execucoes;
+  uint32_t atrasoSoma;
+  uint32_t atrasoMax;
+};
+
+template <uint8_t MaxTarefas, uint8_t Slots = 16>
+class Agendador {
+  static_assert((Slots & (Slots - 1)) == 0, "Slots precisa ser potência de 2");
+
+ public:
+  explicit Agendador(unsigned long (*relogio)()) : relogio_(relogio) {
+    for (uint8_t s = 0; s < Slots; s++) slots_[s] = AGENDA_NENHUMA;
+  }
+
+  // Roda a cada periodo us, a primeira vez depois de atraso us
+  uint8_t periodica(const char* nome, void (*funcao)(), uint32_t periodo, uint32_t atraso = 0) {
+    uint8_t id = criar(nome, funcao, periodo);
+    if (id != AGENDA_NENHUMA) armar(id, atraso);
+    return id;
+  }
+
+  // Criada parada; armar() dispara uma vez
+  uint8_t unica(const char* nome, void (*funcao)()) {
+    return criar(nome, funcao, 0);
+  }
+
+  // (Re)agenda a partir de agora; serve também para adiar
+  void armar(uint8_t id, uint32_t atraso) {
+    if (id >= total_) return;
+    if (tarefas_[id].estado == AGENDADA) retirar(id);
+    tarefas_[id].prazo = (uint32_t)relogio_() + atraso;
+    inserir(id);
+  }
+
+  void parar(uint8_t id) {
+    if (id >= total_) return;
+    if (tarefas_[id].estado == AGENDADA) retirar(id);
+    tarefas_[id].estado = PARADA;
+  }
+
+  // Roda o que venceu e devolve os us até o próximo prazo
+  uint32_t executar() {
+    uint32_t agora = relogio_();
+    uint32_t tickAgora = agora >> AGENDA_TICK_SHIFT;
+
+    // Slots dos ticks que passaram (no máximo uma volta inteira); o tick
+    // atual fica para ser revisto, pode ter prazo mais adiante nele
+    uint32_t passos = tickAgora - cursor_ + 1;
+    if (passos > Slots) passos = Slots;
+
+    uint8_t devidas[MaxTarefas];
+    uint8_t n = 0;
+    for (uint32_t k = 0; k < passos; k++) {
+      uint8_t slot = (cursor_ + k) & (Slots - 1);
+      uint8_t anterior = AGENDA_NENHUMA;
+      uint8_t id = slots_[slot];
+      while (id != AGENDA_NENHUMA) {
+        uint8_t seguinte = tarefas_[id].proxima;
+        if ((int32_t)(agora - tarefas_[id].prazo) >= 0) {
+          if (anterior == AGENDA_NENHUMA) slots_[slot] = seguinte;
+          else tarefas_[anterior].proxima = seguinte;
+          tarefas_[id].estado = DEVIDA;
+          inserirOrdenada(devidas, n, id);
+        } else {
+          anterior = id;
+        }
+        id = seguinte;
+      }
+    }
+    cursor_ = tickAgora;
+
+    for (uint8_t k = 0; k < n; k++) {
+      Tarefa& t = tarefas_[devidas[k]];
+      if (t.estado != DEVIDA) continue;   // parada ou rearmada por outra tarefa
+
+      uint32_t inicio = relogio_();
+      uint32_t atraso = inicio - t.prazo;
+      t.execucoes++;
+      t.atrasoSoma += atraso;
+      if (atraso > t.atrasoMax) t.atrasoMax = atraso;
+
+      t.estado = EXECUTANDO;
+      t.funcao();
+      if (t.estado != EXECUTANDO) continue;   // a própria tarefa se rearmou ou parou
+
+      if (t.periodo == 0) {
+        t.estado = PARADA;
+      } else {
+        // Mantém a fase; se atrasou mais de um período, pula os perdidos
+        t.prazo += t.periodo;
+        if ((int32_t)(relogio_() - t.prazo) >= 0) t.prazo = relogio_() + t.periodo;
+        inserir(devidas[k]);
+      }
+    }
+
+    return esperaAteProxima();
+  }
+
+  // Novo período para uma tarefa periódica, contado a partir de agora;
+  // false para tarefa única (período 0) ou id inválido
+  bool mudarPeriodo(uint8_t id, uint32_t periodo) {
+    if (id >= total_ || periodo == 0 || tarefas_[id].periodo == 0) return false;
+    tarefas_[id].periodo = periodo;
+    if (tarefas_[id].estado == AGENDADA) armar(id, periodo);
+    return true;
+  }
+
+  // nome na RAM (vem do console)
+  uint8_t procurar(const char* nome) const {
+    for (uint8_t id = 0; id < total_; id++) {
+      if (strcmp_P(nome, tarefas_[id].nome) == 0) return id;
+    }
+    return AGENDA_NENHUMA;
+  }
+
+  uint8_t total() const { return total_; }
+  const Tarefa& tarefa(uint8_t id) const { return tarefas_[id]; }
+
+  void zerarEstatisticas() {
+    for (uint8_t id = 0; id < total_; id++) {
+      tarefas_[id].execucoes = 0;
+      tarefas_[id].atrasoSoma = 0;
+      tarefas_[id].atrasoMax = 0;
+    }
+  }
+
+ private:
+  enum { PARADA, AGENDADA, DEVIDA, EXECUTANDO };
+
+  uint8_t criar(const char* nome, void (*funcao)(), uint32_t periodo) {
+    if (total_ >= MaxTarefas) return AGENDA_NENHUMA;
+    uint8_t id = total_++;
+    Tarefa& t = tarefas_[id];
+    t.nome = nome;
+    t.funcao = funcao;
+    t.periodo = periodo;
+    t.prazo = 0;
+    t.proxima = AGENDA_NENHUMA;
+    t.estado = PARADA;
+    t.execucoes = 0;
+    t.atrasoSoma = 0;
+    t.atrasoMax = 0;
+    return id;
+  }
+
+  void inserir(uint8_t id) {
+    uint8_t slot = (tarefas_[id].prazo >> AGENDA_TICK_SHIFT) & (Slots - 1);
+    tarefas_[id].proxima = slots_[slot];
+    slots_[slot] = id;
+    tarefas_[id].estado = AGENDADA;
+  }
+
+  void retirar(uint8_t id) {
+    uint8_t slot = (tarefas_[id].prazo >> AGENDA_TICK_SHIFT) & (Slots - 1);
+    uint8_t* elo = &slots_[slot];
+    while (*elo != AGENDA_NENHUMA && *elo != id) elo = &tarefas_[*elo].proxima;
+    if (*elo == id) *elo = tarefas_[id].proxima;
+  }
+
+  void inserirOrdenada(uint8_t* ids, uint8_t& n, uint8_t id) {
+    uint8_t k = n++;
+    while (k > 0 && (int32_t)(tarefas_[ids[k - 1]].prazo - tarefas_[id].prazo) > 0) {
+      ids[k] = ids[k - 1];
+      k--;
+    }
+    ids[k] = id;
+  }
+
+  uint32_t esperaAteProxima() {
+    uint32_t agora = relogio_();
+    uint32_t espera = AGENDA_ESPERA_MAX;
+    for (uint8_t id = 0; id < total_; id++) {
+      if (tarefas_[id].estado != AGENDADA) continue;
+      int32_t falta = (int32_t)(tarefas_[id].prazo - agora);
+      if (falta <= 0) return 0;
+      if ((uint32_t)falta < espera) espera = falta;
+    }
+    return espera;
+  }
+
+  unsigned long (*relogio_)();
+  Tarefa tarefas_[MaxTarefas];
+  uint8_t slots_[Slots];
+  uint8_t total_ = 0;
+  uint32_t cursor_ = 0;
+};
+
+#endif
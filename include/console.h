@@ -0,0 +1,132 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "flash.h"
+
+// Console de comandos por linha na serial do monitor. Os bytes já ficam no
+// buffer circular de RX da serial; ler() tira no máximo
+// CONSOLE_BYTES_POR_VOLTA por volta do loop() e executa no máximo uma
+// linha, então o custo por volta é limitado e nada espera pelo resto da
+// linha. A linha é quebrada em palavras no próprio buffer e procurada numa
+// tabela de Comando; linha maior que o buffer é descartada inteira.
+//
+//   intervalo led1 200
+//   estado CLEAN
+//
+// A tabela de Comando e os nomes ficam na flash (PROGMEM) e são lidos com
+// pgm_read_*; no AVR um literal no inicializador iria para a SRAM, então
+// cada nome é um vetor PROGMEM próprio.
+//
+// Não depende do Arduino: o Stream é parâmetro de template, e receber()
+// aceita um byte por vez (dá para testar no host).
+
+#define CONSOLE_LINHA 40
+#define CONSOLE_MAX_ARGS 4            // contando o nome do comando
+#define CONSOLE_BYTES_POR_VOLTA 16
+
+enum ResultadoConsole : uint8_t {
+  CONSOLE_OK,
+  CONSOLE_DESCONHECIDO,
+  CONSOLE_FALTAM_ARGS,
+  CONSOLE_ARG_INVALIDO,
+  CONSOLE_LINHA_LONGA,
+  CONSOLE_NADA = 0xFF                 // nenhuma linha completa ainda
+};
+
+struct Comando {
+  const char* nome;                   // PROGMEM
+  uint8_t minArgs;                    // sem contar o nome
+  uint8_t (*funcao)(uint8_t argc, char* argv[]);   // argv[0] é o nome
+};
+
+// Número decimal sem sinal; false se não for só dígitos ou passar de 9
+inline bool lerNumero(const char* s, uint32_t& valor) {
+  uint32_t v = 0;
+  uint8_t n = 0;
+  for (; *s; s++, n++) {
+    if (*s < '0' || *s > '9' || n >= 9) return false;
+    v = v * 10 + (*s - '0');
+  }
+  if (n == 0) return false;
+  valor = v;
+  return true;
+}
+
+template <uint8_t NComandos>
+class Console {
+ public:
+  explicit Console(const Comando (&comandos)[NComandos]) : comandos_(comandos) {}
+
+  template <typename S>
+  uint8_t ler(S& serial) {
+    for (uint8_t k = 0; k < CONSOLE_BYTES_POR_VOLTA && serial.available() > 0; k++) {
+      uint8_t r = receber(serial.read());
+      if (r != CONSOLE_NADA) return r;
+    }
+    return CONSOLE_NADA;
+  }
+
+  // Um byte; devolve o resultado quando fecha uma linha
+  uint8_t receber(char c) {
+    if (c != '\n' && c != '\r') {
+      if (tamanho_ < CONSOLE_LINHA - 1) linha_[tamanho_++] = c;
+      else estourou_ = true;
+      return CONSOLE_NADA;
+    }
+
+    uint8_t r = CONSOLE_NADA;
+    if (estourou_) {
+      nome_[0] = '\0';
+      r = CONSOLE_LINHA_LONGA;
+    } else if (tamanho_ > 0) {
+      linha_[tamanho_] = '\0';
+      r = executar();
+    }
+    tamanho_ = 0;
+    estourou_ = false;
+    return r;   // linha vazia (ou o \n do \r\n) não conta
+  }
+
+  // Nome do último comando, para a resposta
+  const char* nome() const { return nome_; }
+
+ private:
+  uint8_t executar() {
+    char* argv[CONSOLE_MAX_ARGS];
+    uint8_t argc = 0;
+    bool demais = false;
+    char* p = linha_;
+    while (*p) {
+      while (*p == ' ' || *p == '\t') *p++ = '\0';
+      if (!*p) break;
+      if (argc < CONSOLE_MAX_ARGS) argv[argc++] = p;
+      else demais = true;
+      while (*p && *p != ' ' && *p != '\t') p++;
+    }
+    if (argc == 0) return CONSOLE_NADA;
+
+    strncpy(nome_, argv[0], sizeof(nome_) - 1);
+    nome_[sizeof(nome_) - 1] = '\0';
+    if (demais) return CONSOLE_ARG_INVALIDO;
+
+    for (uint8_t k = 0; k < NComandos; k++) {
+      const Comando& c = comandos_[k];
+      if (strcmp_P(argv[0], (const char*)pgm_read_ptr(&c.nome)) != 0) continue;
+      if (argc - 1 < pgm_read_byte(&c.minArgs)) return CONSOLE_FALTAM_ARGS;
+      uint8_t (*funcao)(uint8_t, char* []) = (uint8_t (*)(uint8_t, char* []))pgm_read_ptr(&c.funcao);
+      return funcao(argc, argv);
+    }
+    return CONSOLE_DESCONHECIDO;
+  }
+
+  const Comando (&comandos_)[NComandos];
+  char linha_[CONSOLE_LINHA];
+  uint8_t tamanho_ = 0;
+  bool estourou_ = false;
+  char nome_[8] = "";
+};
+
+#endif
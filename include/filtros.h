@@ -0,0 +1,110 @@
+#ifndef FILTROS_H
+#define FILTROS_H
+
+#include <stdint.h>
+
+// Filtros em inteiros para as leituras do Arduino (nada de ponto flutuante
+// no AVR). Cada estágio tem filtrar(x) em int16_t e guarda o próprio
+// estado; Cadeia<A, B> passa a saída de A para B e também é um estágio,
+// então a sequência fica fixa em tempo de compilação:
+//
+//   Cadeia<Mediana<3>, MediaExp<3> > ldr;    // mediana de 3, depois EMA 1/8
+//
+// Faixas fecha a sequência: limites crescentes com histerese, devolve em
+// quantos deles o valor está acima (0..número de limites).
+
+// Mediana das últimas N amostras; tira picos isolados sem atrasar degraus
+// mais que N/2 amostras. Antes de encher usa só as que tem.
+template <uint8_t N>
+class Mediana {
+  static_assert(N % 2 == 1 && N <= 9, "mediana de poucas amostras, N ímpar");
+
+ public:
+  int16_t filtrar(int16_t x) {
+    janela_[pos_] = x;
+    pos_ = (pos_ + 1) % N;
+    if (cheia_ < N) cheia_++;
+
+    // Inserção numa cópia: no máximo N(N-1)/2 comparações
+    int16_t ordem[N];
+    for (uint8_t k = 0; k < cheia_; k++) {
+      int16_t v = janela_[k];
+      uint8_t j = k;
+      while (j > 0 && ordem[j - 1] > v) {
+        ordem[j] = ordem[j - 1];
+        j--;
+      }
+      ordem[j] = v;
+    }
+    return ordem[(cheia_ - 1) / 2];
+  }
+
+ private:
+  int16_t janela_[N];
+  uint8_t pos_ = 0;
+  uint8_t cheia_ = 0;
+};
+
+// Média exponencial com alfa = 1 / 2^Shift; a soma guarda a saída
+// multiplicada por 2^Shift, então só tem soma e deslocamento. A primeira
+// amostra inicia a média (sem subir a partir de zero).
+template <uint8_t Shift>
+class MediaExp {
+  static_assert(Shift >= 1 && Shift <= 8, "alfa entre 1/2 e 1/256");
+
+ public:
+  int16_t filtrar(int16_t x) {
+    if (!iniciada_) {
+      soma_ = (int32_t)x << Shift;
+      iniciada_ = true;
+    } else {
+      soma_ += x - (soma_ >> Shift);
+    }
+    return soma_ >> Shift;
+  }
+
+ private:
+  int32_t soma_ = 0;
+  bool iniciada_ = false;
+};
+
+template <typename A, typename B>
+class Cadeia {
+ public:
+  int16_t filtrar(int16_t x) { return segundo.filtrar(primeiro.filtrar(x)); }
+
+  A primeiro;
+  B segundo;
+};
+
+// Faixas<margem, limite0, limite1, ...>: sobe de faixa só com o valor
+// acima de limite + margem e desce só com ele em limite - margem ou
+// abaixo, então ruído em volta de um limite não fica trocando a saída.
+template <int16_t Margem, int16_t... Limites>
+class Faixas {
+  static constexpr uint8_t N = sizeof...(Limites);
+  static constexpr int16_t limites_[N] = { Limites... };
+
+ public:
+  uint8_t filtrar(int16_t x) {
+    if (!iniciada_) {
+      while (nivel_ < N && x > limites_[nivel_]) nivel_++;
+      iniciada_ = true;
+      return nivel_;
+    }
+    while (nivel_ < N && x > limites_[nivel_] + Margem) nivel_++;
+    while (nivel_ > 0 && x <= limites_[nivel_ - 1] - Margem) nivel_--;
+    return nivel_;
+  }
+
+  uint8_t nivel() const { return nivel_; }
+
+ private:
+  uint8_t nivel_ = 0;
+  bool iniciada_ = false;
+};
+
+template <int16_t Margem, int16_t... Limites>
+constexpr int16_t Faixas<Margem, Limites...>::limites_[];
+
+#endif
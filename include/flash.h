@@ -0,0 +1,31 @@
+#ifndef FLASH_H
+#define FLASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Dados constantes na flash (PROGMEM) com o mesmo código nas três
+// plataformas: no AVR a flash tem outro espaço de endereços e só se lê com
+// pgm_read_* e as funções _P; no ESP32 ela é mapeada na memória e as
+// macros do core só leem o ponteiro; no host (testes) idem, aqui.
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#elif defined(ARDUINO)
+#include <pgmspace.h>
+#else
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define strcmp_P strcmp
+#define strcasecmp_P strcasecmp
+#define strncpy_P strncpy
+#define strlen_P strlen
+#include <strings.h>
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef FSM_H
+#define FSM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "flash.h"
+
+// Máquina de estados dirigida por tabela. Cada sketch declara, em PROGMEM:
+//   - um vetor de AcoesEstado (nome e ações de entrada, execução e saída)
+//   - uma tabela densa Transicao[estado][evento]
+// disparar() é um acesso direto à tabela, sem if/switch por estado. As
+// tabelas são lidas só com pgm_read_*, então no Leonardo não ocupam SRAM.
+// Guarda nula deixa a transição sempre valer; ação nula é ignorada.
+
+#define FSM_SEM_TRANSICAO 0xFF
+
+struct AcoesEstado {
+  const char* nome;       // PROGMEM, como as tabelas
+  void (*entrada)();
+  void (*executar)();     // a cada volta do loop()
+  void (*saida)();
+};
+
+struct Transicao {
+  uint8_t para;           // FSM_SEM_TRANSICAO: o evento é ignorado no estado
+  bool (*guarda)();
+};
+
+template <uint8_t NEstados, uint8_t NEventos>
+class Maquina {
+ public:
+  typedef Transicao Tabela[NEstados][NEventos];
+
+  // aoMudar (opcional) roda em toda troca, entre a saída e a entrada
+  Maquina(const AcoesEstado (&estados)[NEstados], const Tabela& tabela,
+          void (*aoMudar)(uint8_t de, uint8_t para) = NULL)
+      : estados_(estados), tabela_(tabela), aoMudar_(aoMudar) {}
+
+  void iniciar(uint8_t estado) {
+    atual_ = estado;
+    rodar(&estados_[atual_].entrada);
+  }
+
+  // true se o evento trocou de estado
+  bool disparar(uint8_t evento) {
+    const Transicao* t = &tabela_[atual_][evento];
+    uint8_t para = pgm_read_byte(&t->para);
+    if (para == FSM_SEM_TRANSICAO) return false;
+    bool (*guarda)() = (bool (*)())pgm_read_ptr(&t->guarda);
+    if (guarda && !guarda()) return false;
+    irPara(para);
+    return true;
+  }
+
+  // Troca direta, para quem recebe o estado de fora (estado inválido vai
+  // para o primeiro)
+  void irPara(uint8_t estado) {
+    if (estado >= NEstados) estado = 0;
+    uint8_t de = atual_;
+    rodar(&estados_[de].saida);
+    atual_ = estado;
+    if (aoMudar_) aoMudar_(de, estado);
+    rodar(&estados_[estado].entrada);
+  }
+
+  void executar() {
+    rodar(&estados_[atual_].executar);
+  }
+
+  uint8_t atual() const { return atual_; }
+  // Nomes na flash: Serial.print((const __FlashStringHelper*)robo.nome()),
+  // strcmp_P/strcasecmp_P para comparar
+  const char* nome() const { return nome(atual_); }
+  const char* nome(uint8_t estado) const {
+    return (estado < NEstados) ? (const char*)pgm_read_ptr(&estados_[estado].nome) : PSTR("?");
+  }
+
+ private:
+  static void rodar(void (* const* acao)()) {
+    void (*f)() = (void (*)())pgm_read_ptr(acao);
+    if (f) f();
+  }
+
+  const AcoesEstado (&estados_)[NEstados];
+  const Tabela& tabela_;
+  void (*aoMudar_)(uint8_t, uint8_t);
+  uint8_t atual_ = 0;
+};
+
+#endif
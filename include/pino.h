@@ -0,0 +1,152 @@
+#ifndef PINO_H
+#define PINO_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+#endif
+
+// Pino resolvido em tempo de compilação: Pino<LED1_PIN, PINO_SAIDA> vira
+// acesso direto ao registrador da porta, sem as tabelas de digitalWrite().
+//   - Leonardo (ATmega32U4): sbi/cbi em PORTx, escrita em PINx alterna
+//   - ESP32: registradores W1TS/W1TC do GPIO (uma escrita, sem ler antes)
+//   - outras placas: cai no digitalWrite()/digitalRead()
+// pinMode() continua no iniciar(), que só roda no setup().
+//
+// SaidaSombra guarda o último nível escrito e só toca o pino quando ele
+// muda; quem chama a cada volta (ações de estado) pode escrever sempre.
+
+enum ModoPino : uint8_t {
+  PINO_ENTRADA,
+  PINO_ENTRADA_PULLUP,
+  PINO_SAIDA
+};
+
+#if defined(__AVR_ATmega32U4__)
+
+// porta << 3 | bit de cada pino digital, na ordem do pins_arduino.h da
+// variante leonardo (portas B, C, D, E, F = 0..4)
+#define PINO_AVR(porta, bit) (((porta) << 3) | (bit))
+#define PB_ 0
+#define PC_ 1
+#define PD_ 2
+#define PE_ 3
+#define PF_ 4
+
+constexpr uint8_t PINOS_LEONARDO[] = {
+  PINO_AVR(PD_, 2), PINO_AVR(PD_, 3), PINO_AVR(PD_, 1), PINO_AVR(PD_, 0),   // D0-D3
+  PINO_AVR(PD_, 4), PINO_AVR(PC_, 6), PINO_AVR(PD_, 7), PINO_AVR(PE_, 6),   // D4-D7
+  PINO_AVR(PB_, 4), PINO_AVR(PB_, 5), PINO_AVR(PB_, 6), PINO_AVR(PB_, 7),   // D8-D11
+  PINO_AVR(PD_, 6), PINO_AVR(PC_, 7), PINO_AVR(PB_, 3), PINO_AVR(PB_, 1),   // D12-D15
+  PINO_AVR(PB_, 2), PINO_AVR(PB_, 0), PINO_AVR(PF_, 7), PINO_AVR(PF_, 6),   // D16, RXLED, A0, A1
+  PINO_AVR(PF_, 5), PINO_AVR(PF_, 4), PINO_AVR(PF_, 1), PINO_AVR(PF_, 0),   // A2-A5
+  PINO_AVR(PD_, 4), PINO_AVR(PD_, 7), PINO_AVR(PB_, 4), PINO_AVR(PB_, 5),   // A6-A9
+  PINO_AVR(PB_, 6), PINO_AVR(PD_, 6), PINO_AVR(PD_, 5),                     // A10, A11, TXLED
+};
+
+#undef PB_
+#undef PC_
+#undef PD_
+#undef PE_
+#undef PF_
+
+// PINx, DDRx e PORTx ficam em sequência, e as portas a cada 3 endereços
+// a partir de PINB (0x23)
+#define PINO_REG(endereco) (*(volatile uint8_t*)(endereco))
+
+template <uint8_t N, ModoPino Modo>
+struct Pino {
+  static_assert(N < sizeof(PINOS_LEONARDO), "pino inexistente no Leonardo");
+
+  static constexpr uint8_t mascara = 1 << (PINOS_LEONARDO[N] & 0x07);
+  static constexpr uint8_t base = 0x23 + 3 * (PINOS_LEONARDO[N] >> 3);
+
+  static void iniciar() {
+    if (Modo == PINO_SAIDA) {
+      PINO_REG(base + 1) |= mascara;
+    } else {
+      PINO_REG(base + 1) &= ~mascara;
+      if (Modo == PINO_ENTRADA_PULLUP) PINO_REG(base + 2) |= mascara;
+      else PINO_REG(base + 2) &= ~mascara;
+    }
+  }
+
+  static void escrever(bool nivel) {
+    if (nivel) PINO_REG(base + 2) |= mascara;
+    else PINO_REG(base + 2) &= ~mascara;
+  }
+
+  static void alternar() { PINO_REG(base) = mascara; }
+
+  static bool ler() { return PINO_REG(base) & mascara; }
+};
+
+#elif defined(ARDUINO_ARCH_ESP32)
+
+template <uint8_t N, ModoPino Modo>
+struct Pino {
+  static_assert(N < 40, "GPIO inexistente no ESP32");
+  static_assert(Modo != PINO_SAIDA || N < 34, "GPIO 34-39 são só entrada");
+
+  static constexpr uint32_t mascara = 1UL << (N & 31);
+
+  static void iniciar() {
+    pinMode(N, Modo == PINO_SAIDA ? OUTPUT : (Modo == PINO_ENTRADA_PULLUP ? INPUT_PULLUP : INPUT));
+  }
+
+  static void escrever(bool nivel) {
+    if (N < 32) REG_WRITE(nivel ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, mascara);
+    else REG_WRITE(nivel ? GPIO_OUT1_W1TS_REG : GPIO_OUT1_W1TC_REG, mascara);
+  }
+
+  static void alternar() {
+    escrever(!(REG_READ(N < 32 ? GPIO_OUT_REG : GPIO_OUT1_REG) & mascara));
+  }
+
+  static bool ler() {
+    return REG_READ(N < 32 ? GPIO_IN_REG : GPIO_IN1_REG) & mascara;
+  }
+};
+
+#else
+
+template <uint8_t N, ModoPino Modo>
+struct Pino {
+  static void iniciar() {
+    pinMode(N, Modo == PINO_SAIDA ? OUTPUT : (Modo == PINO_ENTRADA_PULLUP ? INPUT_PULLUP : INPUT));
+  }
+  static void escrever(bool nivel) { digitalWrite(N, nivel ? HIGH : LOW); }
+  static void alternar() { digitalWrite(N, !digitalRead(N)); }
+  static bool ler() { return digitalRead(N) == HIGH; }
+};
+
+#endif
+
+template <uint8_t N>
+class SaidaSombra {
+ public:
+  typedef Pino<N, PINO_SAIDA> Saida;
+
+  void iniciar(bool nivel) {
+    Saida::iniciar();
+    Saida::escrever(nivel);
+    nivel_ = nivel;
+  }
+
+  void escrever(bool nivel) {
+    if (nivel == nivel_) return;
+    nivel_ = nivel;
+    Saida::escrever(nivel);
+  }
+
+  void alternar() { escrever(!nivel_); }
+
+  bool nivel() const { return nivel_; }
+
+ private:
+  bool nivel_ = false;
+};
+
+#endif
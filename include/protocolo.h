@@ -0,0 +1,182 @@
+#ifndef PROTOCOLO_H
+#define PROTOCOLO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Enlace serial entre o Arduino (sensores) e o ESP32 (estado do robô).
+// Quadro:
+//   SYNC | tipo | seq | len | payload[len] | CRC16 (LSB primeiro)
+// O CRC-16/CCITT (0x1021, início 0xFFFF) cobre tipo, seq, len e payload.
+// seq é por tipo e por sentido; buracos na sequência contam como perdidos.
+// Os dois lados são little-endian, então os payloads vão como estão na
+// memória; os tamanhos são fixos para AVR e Xtensa darem o mesmo layout.
+
+#define PROTO_SYNC 0xA5
+#define PROTO_MAX_PAYLOAD 32
+#define PROTO_OVERHEAD 6       // SYNC, tipo, seq, len e CRC
+#define PROTO_BAUD 115200
+
+enum TipoQuadro {
+  QUADRO_SENSORES = 0x01,      // Arduino -> ESP32
+  QUADRO_ESTADO = 0x02         // ESP32 -> Arduino
+};
+
+#define SENSOR_DHT_VALIDO 0x01
+#define SENSOR_DIST_FAIXA 0x06       // 0 sem obstáculo .. 3 perto, já filtrada
+#define SENSOR_DIST_SHIFT 1
+#define SENSOR_LUZ 0x08              // obstáculo acima
+#define SENSOR_UMIDADE_ALTA 0x10
+
+struct PayloadSensores {
+  uint32_t instante;           // millis() do Arduino
+  uint16_t distCm;             // mediana; 0 = nada no alcance
+  uint16_t ldr;                // analogRead() filtrado
+  int16_t umidade;             // décimos de %
+  int16_t temperatura;         // décimos de grau
+  uint16_t idadeDht;           // ms desde a leitura boa (satura em 65535)
+  uint16_t flags;
+};
+
+struct PayloadEstado {
+  uint32_t instante;           // millis() do ESP32
+  uint8_t estado;              // IDLE, CLEAN, DOCK ou CHRG
+  uint8_t reservado[3];
+};
+
+static_assert(sizeof(PayloadSensores) == 16, "layout do quadro de sensores");
+static_assert(sizeof(PayloadEstado) == 8, "layout do quadro de estado");
+
+inline uint16_t crc16Update(uint16_t crc, uint8_t b) {
+  crc ^= (uint16_t)b << 8;
+  for (uint8_t k = 0; k < 8; k++) {
+    crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+// Monta o quadro em buf (PROTO_OVERHEAD + len bytes); retorna o tamanho
+inline size_t montarQuadro(uint8_t* buf, uint8_t tipo, uint8_t seq,
+                           const void* payload, uint8_t len) {
+  buf[0] = PROTO_SYNC;
+  buf[1] = tipo;
+  buf[2] = seq;
+  buf[3] = len;
+  memcpy(buf + 4, payload, len);
+
+  uint16_t crc = 0xFFFF;
+  for (size_t k = 1; k < 4 + (size_t)len; k++) crc = crc16Update(crc, buf[k]);
+  buf[4 + len] = crc & 0xFF;
+  buf[5 + len] = crc >> 8;
+  return PROTO_OVERHEAD + len;
+}
+
+// Recebe byte a byte e ressincroniza sozinho no próximo SYNC depois de
+// lixo ou CRC errado. Um quadro completo fica em tipo()/payload() até o
+// próximo byte.
+class Decodificador {
+ public:
+  // true quando b fecha um quadro válido
+  bool receber(uint8_t b) {
+    switch (estado_) {
+      case ESPERA_SYNC:
+        if (b == PROTO_SYNC) {
+          crc_ = 0xFFFF;
+          estado_ = LE_TIPO;
+        } else {
+          descartados++;
+        }
+        return false;
+
+      case LE_TIPO:
+        tipo_ = b;
+        crc_ = crc16Update(crc_, b);
+        estado_ = LE_SEQ;
+        return false;
+
+      case LE_SEQ:
+        seq_ = b;
+        crc_ = crc16Update(crc_, b);
+        estado_ = LE_LEN;
+        return false;
+
+      case LE_LEN:
+        if (b > PROTO_MAX_PAYLOAD) {
+          erros++;
+          estado_ = ESPERA_SYNC;
+          return false;
+        }
+        len_ = b;
+        pos_ = 0;
+        crc_ = crc16Update(crc_, b);
+        estado_ = (len_ > 0) ? LE_PAYLOAD : LE_CRC0;
+        return false;
+
+      case LE_PAYLOAD:
+        payload_[pos_++] = b;
+        crc_ = crc16Update(crc_, b);
+        if (pos_ == len_) estado_ = LE_CRC0;
+        return false;
+
+      case LE_CRC0:
+        crcLido_ = b;
+        estado_ = LE_CRC1;
+        return false;
+
+      case LE_CRC1:
+        estado_ = ESPERA_SYNC;
+        crcLido_ |= (uint16_t)b << 8;
+        if (crcLido_ != crc_) {
+          erros++;
+          return false;
+        }
+        contarSequencia();
+        recebidos++;
+        return true;
+    }
+    return false;
+  }
+
+  uint8_t tipo() const { return tipo_; }
+  uint8_t seq() const { return seq_; }
+  uint8_t tamanho() const { return len_; }
+  const uint8_t* payload() const { return payload_; }
+
+  // Copia o payload se o tamanho bate com o esperado para o tipo
+  bool ler(void* destino, size_t tamanho) const {
+    if (len_ != tamanho) return false;
+    memcpy(destino, payload_, tamanho);
+    return true;
+  }
+
+  uint32_t recebidos = 0;
+  uint32_t erros = 0;          // CRC ou tamanho inválido
+  uint32_t perdidos = 0;       // buracos no seq
+  uint32_t descartados = 0;    // bytes fora de quadro
+
+ private:
+  enum Estado { ESPERA_SYNC, LE_TIPO, LE_SEQ, LE_LEN, LE_PAYLOAD, LE_CRC0, LE_CRC1 };
+
+  void contarSequencia() {
+    uint8_t t = tipo_ & 0x03;
+    if (visto_ & (1 << t)) {
+      perdidos += (uint8_t)(seq_ - ultimoSeq_[t] - 1);
+    }
+    visto_ |= 1 << t;
+    ultimoSeq_[t] = seq_;
+  }
+
+  Estado estado_ = ESPERA_SYNC;
+  uint8_t tipo_ = 0;
+  uint8_t seq_ = 0;
+  uint8_t len_ = 0;
+  uint8_t pos_ = 0;
+  uint16_t crc_ = 0;
+  uint16_t crcLido_ = 0;
+  uint8_t payload_[PROTO_MAX_PAYLOAD];
+  uint8_t ultimoSeq_[4];
+  uint8_t visto_ = 0;
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef ROOMBA_H
+#define ROOMBA_H
+
+#include <stdint.h>
+
+// Estados do robô, iguais nos dois lados do enlace (vão no PayloadEstado)
+enum EstadoRobo : uint8_t {
+  IDLE,
+  CLEAN,
+  DOCK,
+  CHRG,
+  N_ESTADOS
+};
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef TELEMETRIA_H
+#define TELEMETRIA_H
+
+#include <Arduino.h>
+#include "protocolo.h"
+
+// Telemetria binária na serial do monitor: cada registro vai num quadro do
+// protocolo do enlace (SYNC, tipo, seq, len, payload, CRC16) para um buffer
+// circular, e drenar() manda só o que cabe no buffer de TX da serial, sem
+// nunca esperar. O texto fica para o visualizador (tools/telemetria.py).
+// Sem espaço no buffer o registro inteiro é descartado e contado.
+
+enum TipoTelemetria {
+  TLM_ESTADO = 0x10,
+  TLM_LOOP = 0x11,
+  TLM_TAREFA = 0x12,
+  TLM_ENLACE = 0x13,
+  TLM_LATENCIA = 0x14,
+  TLM_RESPOSTA = 0x15
+};
+
+enum OrigemTelemetria {
+  ORIGEM_ARDUINO = 0,
+  ORIGEM_ESP32 = 1
+};
+
+#define TLM_DIST_FAIXA 0x03    // 0 sem obstáculo .. 3 perto
+#define TLM_LUZ 0x04           // obstáculo acima
+#define TLM_UMIDADE_ALTA 0x08
+#define TLM_DHT_VALIDO 0x10
+#define TLM_SEM_SENSORES 0x20  // ESP32 sem quadros recentes do Arduino
+
+#define TLM_HIST_FAIXAS 6
+#define TLM_NOME_TAREFA 7
+
+struct RegistroEstado {
+  uint32_t instante;     // millis() de quem envia
+  uint8_t origem;
+  uint8_t estado;
+  uint8_t flags;
+  uint8_t falhasDht;
+  uint16_t distCm;
+  uint16_t ldr;
+  int16_t umidade;       // décimos de %
+  int16_t temperatura;   // décimos de grau
+  uint16_t idadeDht;     // ms, satura em 65535
+  uint16_t reservado;
+};
+
+struct RegistroLoop {
+  uint16_t voltasHz;
+  uint16_t loopMax;      // us, satura
+  uint16_t hist[TLM_HIST_FAIXAS];   // voltas por faixa de duração (zeros se não medido)
+  uint16_t emissaoUltima;   // us que a emissão anterior segurou o loop
+  uint16_t emissaoMax;
+  uint16_t descartados;  // registros sem espaço no buffer
+  uint8_t ocioso;        // %
+  uint8_t reservado;
+};
+
+struct RegistroTarefa {
+  uint8_t id;
+  char nome[TLM_NOME_TAREFA];
+  uint32_t execucoes;
+  uint32_t atrasoMedio;  // us
+  uint32_t atrasoMax;
+};
+
+struct RegistroEnlace {
+  uint16_t enviados;
+  uint16_t semEspaco;
+  uint32_t recebidos;
+  uint32_t erros;
+  uint32_t perdidos;
+  uint32_t descartados;
+};
+
+// Arduino: sonar pronto -> quadro; ESP32: quadro -> reação a obstáculo
+struct RegistroLatencia {
+  uint16_t eventos;
+  uint16_t perdidos;
+  uint32_t media;        // us
+  uint32_t max;
+};
+
+// Resposta a uma linha do console (ResultadoConsole de console.h)
+struct RegistroResposta {
+  uint8_t resultado;
+  char comando[TLM_NOME_TAREFA];
+};
+
+static_assert(sizeof(RegistroEstado) == 20, "layout do registro de estado");
+static_assert(sizeof(RegistroLoop) == 24, "layout do registro do loop");
+static_assert(sizeof(RegistroTarefa) == 20, "layout do registro de tarefa");
+static_assert(sizeof(RegistroEnlace) == 20, "layout do registro do enlace");
+static_assert(sizeof(RegistroLatencia) == 12, "layout do registro de latência");
+static_assert(sizeof(RegistroResposta) == 8, "layout do registro de resposta");
+
+inline uint16_t saturar16(unsigned long valor) {
+  return (valor > 0xFFFF) ? 0xFFFF : valor;
+}
+
+template <uint16_t Tamanho>
+class Telemetria {
+ public:
+  // Enfileira o registro inteiro ou nada
+  bool registrar(uint8_t tipo, const void* payload, uint8_t len) {
+    uint8_t quadro[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+    size_t n = montarQuadro(quadro, tipo, seq_, payload, len);
+    if ((size_t)(Tamanho - ocupado_) < n) {
+      descartados++;
+      return false;
+    }
+    for (size_t k = 0; k < n; k++) {
+      buf_[(inicio_ + ocupado_ + k) % Tamanho] = quadro[k];
+    }
+    ocupado_ += n;
+    seq_++;
+    return true;
+  }
+
+  // Escreve só o que a serial aceita agora
+  void drenar(Stream& serial) {
+    while (ocupado_ > 0) {
+      int livre = serial.availableForWrite();
+      if (livre <= 0) return;
+      size_t n = ocupado_;
+      if (n > (size_t)livre) n = livre;
+      if (n > (size_t)(Tamanho - inicio_)) n = Tamanho - inicio_;   // até a volta do buffer
+      serial.write(buf_ + inicio_, n);
+      inicio_ = (inicio_ + n) % Tamanho;
+      ocupado_ -= n;
+    }
+  }
+
+  uint16_t pendentes() const { return ocupado_; }
+
+  uint16_t descartados = 0;
+
+ private:
+  uint8_t buf_[Tamanho];
+  uint16_t inicio_ = 0;
+  uint16_t ocupado_ = 0;
+  uint8_t seq_ = 0;
+};
+
+#endif
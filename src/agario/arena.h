@@ -0,0 +1,122 @@
+#ifndef AGARIO_ARENA_H
+#define AGARIO_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <ArduinoJson.h>
+
+// Alocador "bump" de tamanho fixo para os JsonDocument de curta duração.
+// Nada é liberado individualmente: cada handler restaura a marca ao sair
+// (ArenaScope) e o gameTick zera tudo a cada tick, então o heap nunca vê
+// as alocações das mensagens e não fragmenta.
+class TickArena : public ArduinoJson::Allocator {
+ public:
+  TickArena(uint8_t* buffer, size_t size)
+    : buffer_(buffer), size_(size), top_(0), last_(NULL),
+      highWater_(0), failures_(0) {}
+
+  void* allocate(size_t size) override {
+    size_t start = align(top_) + HEADER;
+    if (start + size > size_) {
+      failures_++;
+      return NULL;
+    }
+    uint8_t* ptr = buffer_ + start;
+    setBlockSize(ptr, size);
+    top_ = start + size;
+    last_ = ptr;
+    if (top_ > highWater_) highWater_ = top_;
+    return ptr;
+  }
+
+  void deallocate(void* ptr) override {
+    // Só o último bloco pode ser devolvido de verdade
+    if (ptr && ptr == last_) {
+      top_ = (uint8_t*)ptr - buffer_ - HEADER;
+      last_ = NULL;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    if (!ptr) return allocate(newSize);
+
+    // O último bloco cresce ou encolhe no lugar
+    if (ptr == last_) {
+      size_t start = (uint8_t*)ptr - buffer_;
+      if (start + newSize > size_) {
+        failures_++;
+        return NULL;
+      }
+      setBlockSize((uint8_t*)ptr, newSize);
+      top_ = start + newSize;
+      if (top_ > highWater_) highWater_ = top_;
+      return ptr;
+    }
+
+    size_t oldSize = blockSize((uint8_t*)ptr);
+    if (newSize <= oldSize) {
+      setBlockSize((uint8_t*)ptr, newSize);
+      return ptr;
+    }
+    void* moved = allocate(newSize);
+    if (moved) memcpy(moved, ptr, oldSize);
+    return moved;
+  }
+
+  size_t mark() const { return top_; }
+
+  void release(size_t mark) {
+    top_ = mark;
+    last_ = NULL;
+  }
+
+  void reset() { release(0); }
+
+  size_t used() const { return top_; }
+  size_t capacity() const { return size_; }
+  size_t highWater() const { return highWater_; }
+  uint32_t failures() const { return failures_; }
+
+  void clearStats() {
+    highWater_ = top_;
+    failures_ = 0;
+  }
+
+ private:
+  // Cada bloco guarda o próprio tamanho logo antes dos dados (para o realloc)
+  static const size_t HEADER = 8;
+
+  static size_t align(size_t n) { return (n + 7) & ~(size_t)7; }
+
+  static size_t blockSize(uint8_t* ptr) {
+    uint32_t size;
+    memcpy(&size, ptr - HEADER, sizeof(size));
+    return size;
+  }
+
+  static void setBlockSize(uint8_t* ptr, size_t size) {
+    uint32_t value = size;
+    memcpy(ptr - HEADER, &value, sizeof(value));
+  }
+
+  uint8_t* buffer_;
+  size_t size_;
+  size_t top_;
+  uint8_t* last_;
+  size_t highWater_;
+  uint32_t failures_;
+};
+
+// Restaura a arena ao sair do escopo: o que um handler aloca não sobrevive a ele
+class ArenaScope {
+ public:
+  explicit ArenaScope(TickArena& arena) : arena_(arena), mark_(arena.mark()) {}
+  ~ArenaScope() { arena_.release(mark_); }
+
+ private:
+  TickArena& arena_;
+  size_t mark_;
+};
+
+#endif
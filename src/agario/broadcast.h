@@ -0,0 +1,284 @@
+#ifndef AGARIO_BROADCAST_H
+#define AGARIO_BROADCAST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+#include "lzss.h"
+#include "arena.h"
+#include "frame.h"
+#include "world.h"
+
+// Saída do servidor: frames do pool, compressão dos grandes e o snapshot
+// periódico (jogadores, ranking e um bloco de pellets). Quem entrega os
+// bytes é o aviso send: a WebSockets no ESP32, nada no replayer do host.
+
+// Compressão dos frames grandes
+#define USE_COMPRESSION 1
+#define COMPRESS_MIN_SIZE 1024
+#define FRAME_LZSS 0x01       // primeiro byte dos frames binários comprimidos
+#define FRAME_REPLACEABLE 0x80 // bit no tipo: snapshot que o próximo substitui (relay pode pular)
+#define FRAME_HEADER_SIZE 5   // tipo + tamanho original (uint32 little-endian)
+
+// Pool de frames de saída: pequenos para mensagens de evento, grandes para
+// o snapshot de pellets e os frames comprimidos (ver frame.h)
+#define SMALL_FRAME_SIZE 2048
+#define SMALL_FRAME_COUNT 3
+#define PELLET_CHUNK 200      // pellets por frame; 1 bloco por broadcast
+#define LARGE_FRAME_SIZE (PELLET_CHUNK * 64)
+#define LARGE_FRAME_COUNT 2
+
+#define BROADCAST_MS 100      // 10 updates por segundo (cliente interpola)
+
+struct CompressionStats {
+  uint32_t frames;
+  uint32_t bytesIn;
+  uint32_t bytesOut;
+  uint32_t micros;
+};
+
+// send é nulo no host; os outros também podem ficar nulos
+struct BroadcastHooks {
+  // buf tem WEBSOCKETS_MAX_HEADER_SIZE bytes livres antes do payload
+  void (*send)(uint8_t* buf, size_t len, bool binary);
+  unsigned long (*micros)();
+  void (*frameMissing)(size_t size);
+};
+
+class Broadcaster {
+ public:
+  Broadcaster(World& world, TickArena& arena)
+    : world_(world), arena_(arena), lastBroadcast_(0), pelletChunk_(0) {
+    memset(&hooks, 0, sizeof(hooks));
+    memset(&lzStats, 0, sizeof(lzStats));
+  }
+
+  // Alocar os buffers do pool uma única vez; false se faltou memória
+  bool begin() {
+    size_t capacities[SMALL_FRAME_COUNT + LARGE_FRAME_COUNT];
+    for (int i = 0; i < SMALL_FRAME_COUNT + LARGE_FRAME_COUNT; i++) {
+      capacities[i] = (i < SMALL_FRAME_COUNT) ? SMALL_FRAME_SIZE : LARGE_FRAME_SIZE;
+    }
+    return frames_.begin(capacities);
+  }
+
+  // Mundo novo: o próximo snapshot sai no primeiro tick
+  void reset() {
+    lastBroadcast_ = 0;
+    pelletChunk_ = 0;
+  }
+
+  Frame* acquire(size_t size) {
+    Frame* frame = frames_.acquire(size);
+    if (!frame && hooks.frameMissing) {
+      hooks.frameMissing(size);
+    }
+    return frame;
+  }
+
+  void release(Frame* frame) {
+    frames_.release(frame);
+  }
+
+  // Serializar o documento direto no payload do frame
+  bool serialize(JsonDocument& doc, Frame* frame) {
+    if (!frame || measureJson(doc) >= frame->capacity) {
+      return false;
+    }
+    frame->len = serializeJson(doc, frame->payload(), frame->capacity);
+    return true;
+  }
+
+  // Enviar um frame a todos; frames grandes vão comprimidos como binário.
+  // replaceable marca no tipo do binário que o frame é um snapshot inteiro,
+  // para quem repassa (relay) poder descartar sem abrir o LZSS.
+  void send(Frame* frame, bool replaceable = false) {
+    if (!frame || frame->overflow) {
+      return;
+    }
+
+#if USE_COMPRESSION
+    if (frame->len >= COMPRESS_MIN_SIZE) {
+      Frame* packedFrame = acquire(frame->len);
+
+      if (packedFrame) {
+        uint8_t* out = (uint8_t*)packedFrame->payload();
+        uint32_t start = now();
+        size_t packed = lzss_.compress((const uint8_t*)frame->payload(), frame->len,
+                                       out + FRAME_HEADER_SIZE, frame->len - FRAME_HEADER_SIZE);
+        uint32_t elapsed = now() - start;
+
+        if (packed > 0) {
+          out[0] = FRAME_LZSS | (replaceable ? FRAME_REPLACEABLE : 0);
+          out[1] = frame->len & 0xFF;
+          out[2] = (frame->len >> 8) & 0xFF;
+          out[3] = (frame->len >> 16) & 0xFF;
+          out[4] = (frame->len >> 24) & 0xFF;
+
+          if (hooks.send) {
+            hooks.send(packedFrame->buf, packed + FRAME_HEADER_SIZE, true);
+          }
+
+          lzStats.frames++;
+          lzStats.micros += elapsed;
+          lzStats.bytesIn += frame->len;
+          lzStats.bytesOut += packed + FRAME_HEADER_SIZE;
+          release(packedFrame);
+          return;
+        }
+        release(packedFrame);
+      }
+    }
+#endif
+    if (hooks.send) {
+      hooks.send(frame->buf, frame->len, false);
+    }
+  }
+
+  // Montar e enviar um documento de evento num frame pequeno
+  void sendDocument(JsonDocument& doc) {
+    Frame* frame = acquire(SMALL_FRAME_SIZE);
+    if (serialize(doc, frame)) {
+      send(frame);
+    }
+    release(frame);
+  }
+
+  // Ranking atual (poucos bytes: id, nome e raio do top K)
+  bool writeLeaderboard(Frame* frame) {
+    ArenaScope scope(arena_);
+    JsonDocument doc(&arena_);
+    doc["type"] = "leaderboard";
+    JsonArray top = doc.createNestedArray("top");
+
+    for (int k = 0; k < world_.leaderboard.size(); k++) {
+      int i = world_.leaderboard.at(k);
+      JsonObject entry = top.createNestedObject();
+      entry["id"] = world_.players[i].id;
+      entry["name"] = world_.players[i].name;
+      entry["r"] = (int)world_.players[i].r;
+    }
+    return serialize(doc, frame);
+  }
+
+  // Escrever um bloco de pellets direto no frame
+  void writePelletChunk(Frame* frame, int start) {
+    frame->appendf("{\"type\":\"pellets\",\"start\":%d,\"pellets\":[", start);
+
+    for (int i = start; i < start + PELLET_CHUNK && i < MAX_PELLETS; i++) {
+      const Pellet& pellet = world_.pellets[i];
+      frame->appendf("%s{\"x\":%d,\"y\":%d,\"r\":%d,\"color\":\"%s\"}",
+                     (i > start) ? "," : "",
+                     (int)pellet.x, (int)pellet.y, (int)pellet.r,
+                     pelletColors[pellet.color]);
+    }
+
+    frame->append("]}");
+  }
+
+  // Notificar que o jogador 'eaten' foi comido
+  void playerEaten(int eaten, const char* eaterId, const char* eaterName) {
+    ArenaScope scope(arena_);
+    JsonDocument doc(&arena_);
+    doc["type"] = "playerEaten";
+    doc["eatenId"] = world_.players[eaten].id;
+    doc["eaterId"] = eaterId;
+    doc["eaterName"] = eaterName;
+    sendDocument(doc);
+  }
+
+  // Avisar os clientes de que o slot i foi liberado
+  void playerLeft(int i) {
+    ArenaScope scope(arena_);
+    JsonDocument doc(&arena_);
+    doc["type"] = "playerLeft";
+    doc["playerId"] = world_.players[i].id;
+    sendDocument(doc);
+  }
+
+  // Snapshot a cada BROADCAST_MS do relógio do jogo; true se saiu um
+  bool tick(unsigned long gameNow) {
+    if (gameNow - lastBroadcast_ < BROADCAST_MS) {
+      return false;
+    }
+
+    // Enviar informações dos jogadores
+    ArenaScope scope(arena_);
+    JsonDocument doc(&arena_);
+    doc["type"] = "players";
+    JsonObject playersObj = doc.createNestedObject("players");
+
+    // Espelhos do vizinho primeiro: se o mesmo id já chegou por handoff,
+    // a entrada local sobrescreve a do espelho
+    for (int g = 0; g < MAX_GHOSTS; g++) {
+      const Ghost& ghost = world_.ghosts[g];
+      if (ghost.active) {
+        JsonObject entry = playersObj.createNestedObject(ghost.state.id);
+        entry["x"] = ghost.state.x;
+        entry["y"] = ghost.state.y;
+        entry["r"] = ghost.state.r;
+        entry["ack"] = 0;
+        entry["name"] = ghost.state.name;
+        entry["fillColor"] = ghost.state.fillColor;
+        entry["strokeColor"] = ghost.state.strokeColor;
+      }
+    }
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      const Player& player = world_.players[i];
+      if (player.active) {
+        JsonObject entry = playersObj.createNestedObject(player.id);
+        entry["x"] = player.x;
+        entry["y"] = player.y;
+        entry["r"] = player.r;
+        entry["ack"] = player.lastInputSeq;
+        entry["name"] = player.name;
+        entry["fillColor"] = player.fillColor;
+        entry["strokeColor"] = player.strokeColor;
+      }
+    }
+
+    // Com espelhos o snapshot pode passar do buffer pequeno
+    Frame* frame = acquire(measureJson(doc) + 1);
+    if (serialize(doc, frame)) {
+      send(frame, true);
+    }
+    release(frame);
+
+    // Ranking só quando o top K mudou (ordem ou raio inteiro mostrado)
+    if (world_.leaderboard.changed()) {
+      frame = acquire(SMALL_FRAME_SIZE);
+      if (writeLeaderboard(frame)) {
+        send(frame);
+      }
+      release(frame);
+    }
+
+    // Enviar um bloco de pellets por broadcast (snapshot completo a cada 500 ms)
+    frame = acquire(LARGE_FRAME_SIZE);
+    if (frame) {
+      writePelletChunk(frame, pelletChunk_ * PELLET_CHUNK);
+      send(frame);
+    }
+    release(frame);
+    pelletChunk_ = (pelletChunk_ + 1) % ((MAX_PELLETS + PELLET_CHUNK - 1) / PELLET_CHUNK);
+
+    lastBroadcast_ = gameNow;
+    return true;
+  }
+
+  BroadcastHooks hooks;
+  CompressionStats lzStats;
+
+ private:
+  uint32_t now() const { return hooks.micros ? hooks.micros() : 0; }
+
+  World& world_;
+  TickArena& arena_;
+  FramePool<SMALL_FRAME_COUNT + LARGE_FRAME_COUNT> frames_;
+  LzssEncoder lzss_;
+  unsigned long lastBroadcast_;
+  int pelletChunk_;
+};
+
+#endif
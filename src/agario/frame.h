@@ -0,0 +1,92 @@
+#ifndef AGARIO_FRAME_H
+#define AGARIO_FRAME_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Definido pela WebSockets.h; no host (testes) a biblioteca não existe
+#ifndef WEBSOCKETS_MAX_HEADER_SIZE
+#define WEBSOCKETS_MAX_HEADER_SIZE 14
+#endif
+
+// Buffer de saída: cada frame reserva WEBSOCKETS_MAX_HEADER_SIZE bytes no
+// início para a biblioteca escrever o cabeçalho no lugar (headerToPayload)
+// e o payload é escrito logo depois, sem String nem cópia.
+struct Frame {
+  uint8_t* buf;
+  size_t capacity;   // bytes disponíveis para o payload
+  size_t len;        // bytes de payload escritos
+  bool overflow;
+  bool inUse;
+  
+  char* payload() {
+    return (char*)buf + WEBSOCKETS_MAX_HEADER_SIZE;
+  }
+  
+  void append(const char* text) {
+    size_t n = strlen(text);
+    if (len + n >= capacity) {
+      overflow = true;
+      return;
+    }
+    memcpy(payload() + len, text, n);
+    len += n;
+  }
+  
+  void appendf(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(payload() + len, capacity - len, fmt, args);
+    va_end(args);
+    if (n < 0 || len + n >= capacity) {
+      overflow = true;
+      return;
+    }
+    len += n;
+  }
+};
+
+// Buffers alocados uma única vez em begin(); depois disso montar e enviar
+// frames não toca o heap.
+template <int Count>
+class FramePool {
+ public:
+  // capacities em ordem crescente; false se faltou memória para algum
+  bool begin(const size_t (&capacities)[Count]) {
+    bool ok = true;
+    for (int i = 0; i < Count; i++) {
+      frames_[i].capacity = capacities[i];
+      frames_[i].buf = (uint8_t*)malloc(WEBSOCKETS_MAX_HEADER_SIZE + capacities[i]);
+      frames_[i].inUse = false;
+      ok = ok && frames_[i].buf;
+    }
+    return ok;
+  }
+  
+  // O menor buffer livre com pelo menos 'size' bytes de payload, ou NULL
+  Frame* acquire(size_t size) {
+    for (int i = 0; i < Count; i++) {
+      Frame* frame = &frames_[i];
+      if (!frame->inUse && frame->buf && frame->capacity >= size) {
+        frame->inUse = true;
+        frame->len = 0;
+        frame->overflow = false;
+        return frame;
+      }
+    }
+    return NULL;
+  }
+  
+  void release(Frame* frame) {
+    if (frame) frame->inUse = false;
+  }
+  
+ private:
+  Frame frames_[Count];
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef AGARIO_LEADERBOARD_H
+#define AGARIO_LEADERBOARD_H
+
+#include <stdint.h>
+
+// Ordem dos jogadores por raio, mantida a cada mudança de massa: o id
+// mudado só anda por trocas com os vizinhos até a posição certa, sem
+// reordenar a lista toda. changed() indica se os primeiros TopK ids, a
+// ordem entre eles ou a parte inteira da pontuação de algum deles (o que
+// o ranking mostra) mudaram desde a última consulta.
+
+template <int MaxItems, int TopK>
+class RankedList {
+ public:
+  RankedList() { clear(); }
+
+  void clear() {
+    count_ = 0;
+    changed_ = true;
+    for (int i = 0; i < MaxItems; i++) rank_[i] = -1;
+  }
+
+  // Insere o id ou reposiciona com a nova pontuação
+  void update(int id, float score) {
+    int pos = rank_[id];
+    bool shown = pos >= 0 && (int)score_[id] != (int)score;
+    score_[id] = score;
+    if (pos < 0) {
+      pos = count_++;
+      order_[pos] = id;
+      rank_[id] = pos;
+      if (pos < TopK) changed_ = true;
+    }
+
+    int start = pos;
+    while (pos > 0 && score_[order_[pos - 1]] < score) {
+      swap(pos, pos - 1);
+      pos--;
+    }
+    while (pos < count_ - 1 && score_[order_[pos + 1]] > score) {
+      swap(pos, pos + 1);
+      pos++;
+    }
+    if (pos != start && (pos < TopK || start < TopK)) changed_ = true;
+    if (shown && pos < TopK) changed_ = true;
+  }
+
+  void remove(int id) {
+    int pos = rank_[id];
+    if (pos < 0) return;
+    if (pos < TopK) changed_ = true;
+    for (int k = pos; k < count_ - 1; k++) {
+      order_[k] = order_[k + 1];
+      rank_[order_[k]] = k;
+    }
+    count_--;
+    rank_[id] = -1;
+  }
+
+  int size() const { return count_ < TopK ? count_ : TopK; }
+  int at(int rank) const { return order_[rank]; }
+
+  bool changed() {
+    bool result = changed_;
+    changed_ = false;
+    return result;
+  }
+
+ private:
+  void swap(int a, int b) {
+    int t = order_[a];
+    order_[a] = order_[b];
+    order_[b] = t;
+    rank_[order_[a]] = a;
+    rank_[order_[b]] = b;
+  }
+
+  float score_[MaxItems];
+  int16_t order_[MaxItems];  // ids do maior para o menor
+  int16_t rank_[MaxItems];   // posição de cada id, -1 fora da lista
+  int count_;
+  bool changed_;
+};
+
+#endif
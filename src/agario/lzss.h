@@ -0,0 +1,120 @@
+#ifndef AGARIO_LZSS_H
+#define AGARIO_LZSS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Compressor LZSS no estilo do heatshrink: janela fixa e pequena, sem
+// alocação dinâmica. O formato é um fluxo de bits (MSB primeiro):
+//   1 + 8 bits                 -> literal
+//   0 + LZSS_WINDOW_BITS bits  -> distância - 1
+//     + LZSS_LENGTH_BITS bits  -> tamanho - LZSS_MIN_MATCH
+// O decodificador em JS (lzssDecode) precisa usar os mesmos parâmetros.
+
+#define LZSS_WINDOW_BITS 10
+#define LZSS_LENGTH_BITS 5
+#define LZSS_WINDOW_SIZE (1 << LZSS_WINDOW_BITS)
+#define LZSS_MIN_MATCH 3
+#define LZSS_MAX_MATCH (LZSS_MIN_MATCH + (1 << LZSS_LENGTH_BITS) - 1)
+#define LZSS_HASH_BITS 10
+#define LZSS_HASH_SIZE (1 << LZSS_HASH_BITS)
+#define LZSS_MAX_CHAIN 16
+
+struct LzssEncoder {
+  // Cadeias de hash sobre a janela: 4 KB de RAM, independente do tamanho da entrada
+  uint16_t head[LZSS_HASH_SIZE];
+  uint16_t prev[LZSS_WINDOW_SIZE];
+
+  uint8_t* out;
+  size_t outCap;
+  size_t outLen;
+  uint8_t bitBuf;
+  uint8_t bitCount;
+  bool overflow;
+
+  void putBits(uint32_t value, uint8_t count) {
+    while (count--) {
+      bitBuf = (bitBuf << 1) | ((value >> count) & 1);
+      if (++bitCount == 8) {
+        if (outLen < outCap) out[outLen++] = bitBuf;
+        else overflow = true;
+        bitBuf = 0;
+        bitCount = 0;
+      }
+    }
+  }
+
+  static uint16_t hash(const uint8_t* p) {
+    return ((p[0] << 6) ^ (p[1] << 3) ^ p[2]) & (LZSS_HASH_SIZE - 1);
+  }
+
+  void insert(const uint8_t* in, size_t pos) {
+    uint16_t h = hash(in + pos);
+    prev[pos & (LZSS_WINDOW_SIZE - 1)] = head[h];
+    head[h] = (uint16_t)pos;
+  }
+
+  // Comprime 'in' em 'dst'. Retorna o tamanho comprimido, ou 0 se não
+  // couber em 'dstCap' (nesse caso vale mais enviar o frame original).
+  size_t compress(const uint8_t* in, size_t len, uint8_t* dst, size_t dstCap) {
+    memset(head, 0xFF, sizeof(head));
+    out = dst;
+    outCap = dstCap;
+    outLen = 0;
+    bitBuf = 0;
+    bitCount = 0;
+    overflow = false;
+
+    size_t pos = 0;
+    while (pos < len && !overflow) {
+      size_t bestLen = 0;
+      size_t bestDist = 0;
+
+      if (pos + LZSS_MIN_MATCH <= len) {
+        size_t maxLen = len - pos;
+        if (maxLen > LZSS_MAX_MATCH) maxLen = LZSS_MAX_MATCH;
+
+        uint16_t cand = head[hash(in + pos)];
+        for (int chain = 0; chain < LZSS_MAX_CHAIN; chain++) {
+          // Posições guardadas em 16 bits: a distância também é módulo 2^16,
+          // e o candidato sempre é conferido byte a byte
+          uint16_t dist = (uint16_t)(pos - cand);
+          if (dist == 0 || dist > LZSS_WINDOW_SIZE || dist > pos) break;
+
+          const uint8_t* a = in + pos;
+          const uint8_t* b = a - dist;
+          size_t n = 0;
+          while (n < maxLen && a[n] == b[n]) n++;
+
+          if (n > bestLen) {
+            bestLen = n;
+            bestDist = dist;
+            if (n == maxLen) break;
+          }
+          cand = prev[(pos - dist) & (LZSS_WINDOW_SIZE - 1)];
+        }
+      }
+
+      if (bestLen >= LZSS_MIN_MATCH) {
+        putBits(0, 1);
+        putBits(bestDist - 1, LZSS_WINDOW_BITS);
+        putBits(bestLen - LZSS_MIN_MATCH, LZSS_LENGTH_BITS);
+        for (size_t k = 0; k < bestLen; k++, pos++) {
+          if (pos + LZSS_MIN_MATCH <= len) insert(in, pos);
+        }
+      } else {
+        putBits(1, 1);
+        putBits(in[pos], 8);
+        if (pos + LZSS_MIN_MATCH <= len) insert(in, pos);
+        pos++;
+      }
+    }
+
+    // Completar o último byte com zeros
+    if (bitCount > 0) putBits(0, 8 - bitCount);
+    return overflow ? 0 : outLen;
+  }
+};
+
+#endif
@@ -1,9 +1,18 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <WebServer.h>
+#include <WiFiUdp.h>
 #include <SPIFFS.h>
 #include <WebSocketsServer.h>
 #include <ArduinoJson.h>
+#include "arena.h"
+#include "recording.h"
+#include "snapshot.h"
+#include "frame.h"
+#include "messages.h"
+#include "world.h"
+#include "broadcast.h"
+#include "shard.h"
 
 // Configuração do Access Point
 const char* ap_ssid = "Agario_ESP32";
@@ -14,38 +23,123 @@ WebServer server(80);
 // Servidor WebSocket na porta 81
 WebSocketsServer webSocket = WebSocketsServer(81);
 
-// Estrutura para armazenar dados dos jogadores
-struct Player {
-  String id;
-  String name;
-  float x;
-  float y;
-  float r;
-  float mx;
-  float my;
-  String fillColor;
-  String strokeColor;
-  uint8_t clientNum;
-  unsigned long lastUpdate;
-  bool active;
+// Parâmetros da simulação, bots e ranking: world.h. Frames e compressão: broadcast.h.
+
+#define PING_INTERVAL 1000   // heartbeat: ping (e medida de RTT) a cada intervalo
+#define STATS_INTERVAL 10000
+
+// Memória dos JsonDocument: arena zerada a cada tick, fora do heap
+#define TICK_ARENA_SIZE 8192
+
+// Mundo determinístico e gravação de sessões para reprodução no host
+#define WORLD_SEED 0          // 0: semente nova a cada boot (esp_random)
+#define RECORD_SESSION 0      // 1: gravar a sessão desde o boot
+#define RECORD_FILE "/sessao.rec"
+#define RECORD_BUFFER_SIZE 2048
+#define RECORD_MAX_BYTES (512 * 1024)
+
+// Snapshot do mundo no SPIFFS para reinício a quente
+#define SNAPSHOT_INTERVAL 10000   // uma cópia nova a cada intervalo
+#define SNAPSHOT_CHUNK 512        // bytes gravados por tick
+#define RESUME_WINDOW 60000       // tempo para os jogadores restaurados voltarem
+#define HANDOFF_RESUME_MS 5000    // prazo para o cliente reconectar no shard de destino
+#define SNAPSHOT_MAX_SIZE (sizeof(SnapshotHeader) + MAX_PELLETS * sizeof(SnapshotPellet) \
+                           + MAX_PLAYERS * sizeof(SnapshotPlayer) + sizeof(uint32_t))
+
+// Mundo dividido em faixas verticais, uma por nó (protocolo em shard.h).
+// O shard 0 é o Access Point; o shard k > 0 entra na rede dele com o IP
+// 192.168.4.(SHARD_IP_BASE + k). Com SHARD_COUNT 1 o servidor funciona
+// sozinho, como antes.
+#define SHARD_COUNT 1
+#define SHARD_ID 0
+#define SHARD_PORT 4210           // UDP entre os nós
+#define SHARD_IP_BASE 200
+#define SHARD_CONNECT_TIMEOUT 20000   // shard secundário sem a rede do shard 0: reinicia
+
+// Jogadores, pellets, grades, ranking e histórico
+World world;
+
+struct BroadcastStats {
+  uint32_t count;
+  uint32_t micros;
+  uint32_t maxMicros;
+  uint32_t minFreeHeap;
+  uint8_t clientsAtMin;   // conexões abertas quando o heap livre foi o mínimo
 };
 
-// Mapa de jogadores (máximo 10 jogadores)
-Player players[10];
-int playerCount = 0;
-
-// Pellets compartilhados
-struct Pellet {
-  float x;
-  float y;
-  float r;
-  String color;
-  int numPoints;
-  float angle;
+BroadcastStats txStats = {0, 0, 0, UINT32_MAX, 0};
+
+uint8_t tickArenaBuffer[TICK_ARENA_SIZE];
+TickArena tickArena(tickArenaBuffer, TICK_ARENA_SIZE);
+
+// Pool de frames, compressor e snapshot periódico
+Broadcaster broadcaster(world, tickArena);
+
+// Filtro de chaves aceitas na entrada (montado uma vez no setup)
+JsonDocument inputFilter;
+
+struct ReceiveStats {
+  uint32_t count;
+  uint32_t micros;
+  uint32_t rejected;
+};
+
+ReceiveStats rxStats = {0, 0, 0};
+
+// Relógio do jogo: começa em 0 em resetWorld() e só anda no início de
+// cada loop(), então tudo numa volta (mensagens, tick) vê o mesmo instante,
+// que é o gravado
+unsigned long worldEpoch = 0;
+unsigned long gameClock = 0;
+
+// Temporizadores do servidor, zerados junto com o mundo
+struct WorldTimers {
+  unsigned long lastTick;
+  unsigned long lastPing;
 };
 
-Pellet pellets[1000];
-bool pelletsInitialized = false;
+WorldTimers timers;
+// Gravação: eventos acumulam na RAM e vão para o SPIFFS em blocos
+uint8_t recordBuffer[RECORD_BUFFER_SIZE];
+RecordingWriter recorder(recordBuffer, RECORD_BUFFER_SIZE);
+File recordFile;
+bool recording = false;
+size_t recordedBytes = 0;
+
+// Snapshot: dois arquivos alternados, o mais novo íntegro é o que vale.
+// O estado é copiado de uma vez para o staging e gravado aos pedaços.
+const char* const snapshotFiles[2] = { "/snap0.bin", "/snap1.bin" };
+uint8_t snapshotBuffer[SNAPSHOT_MAX_SIZE];
+File snapshotFile;
+size_t snapshotLength = 0;    // bytes no staging, sem o CRC
+size_t snapshotWritten = 0;
+uint32_t snapshotCrc = 0;
+uint32_t snapshotSeq = 0;
+bool snapshotWriting = false;
+unsigned long lastSnapshot = 0;
+
+struct SnapshotStats {
+  uint32_t writes;
+  uint32_t bytes;
+  uint32_t captureMicros;
+  uint32_t maxChunkMicros;
+};
+
+SnapshotStats snapStats = {0, 0, 0, 0};
+
+// Jogadores restaurados (ou recebidos de outro shard) esperam aqui, fora
+// do jogo, até voltarem com o token
+struct ResumeSlot {
+  SnapshotPlayer player;
+  unsigned long since;
+  unsigned long expires;
+};
+
+ResumeSlot resumeSlots[MAX_PLAYERS];
+
+// Faixa deste nó, handoffs e espelhos; o link é UDP
+ShardNode shardNode(world, SHARD_ID, SHARD_COUNT);
+WiFiUDP shardLink;
 
 // Página HTML com o jogo Agar.io
 const char* html = R"rawliteral(
@@ -79,7 +173,7 @@ const char* html = R"rawliteral(
 		camera_scale_multiplier = 0.8,
 		mouse_screenPosition = {'x': 0, 'y': 0},
 		fastest_cell_speed = 250,
-		objects = {'cells': {}, 'pellets': {}},
+		objects = {'cells': {}, 'pellets': []},
 		world_size = {'x': 5000, 'y': 5000},
 		player_world_position = {'x': (world_size.x / 2), 'y': (world_size.y / 2)},
 		player_speed_per_second = 30,
@@ -92,7 +186,33 @@ const char* html = R"rawliteral(
 			'W': 119
 		},
 		input_active = {},
-		game_fps = 0;
+		game_fps = 0,
+		interpolation_delay = 200, // ms atrás do servidor (2 broadcasts a 10 Hz)
+		snapshot_buffer_max = 16,
+		debug_overlay_time = 0,
+		LZSS_FRAME = 0x01,
+		FRAME_REPLACEABLE = 0x80, // só interessa ao relay
+		LZSS_WINDOW_BITS = 10,
+		LZSS_LENGTH_BITS = 5,
+		LZSS_MIN_MATCH = 3,
+		text_decoder = new TextDecoder('utf-8'),
+		input_sequence = 0,
+		pending_inputs = [],
+		server_host = window.location.hostname, // muda quando o servidor manda para outro shard
+		player_name = null,
+		handoff_pending = false,
+		leaderboard = [], // top K enviado pelo servidor quando a ordem muda
+		spectator = /(^|[?&])spectate(&|=|$)/.test(window.location.search), // só assiste, não entra no jogo
+		pellet_sprites = {'canvas': null, 'slots': {}, 'count': 0, 'size': 0},
+		grid_pattern = null,
+		view_rect = {'left': 0, 'top': 0, 'right': 0, 'bottom': 0},
+		frame_stats = {
+			'limits':	[8, 16, 33, 50, 100],
+			'buckets':	[0, 0, 0, 0, 0, 0],
+			'work_ms':	0,
+			'frames':	0,
+			'pellets_drawn': 0
+		};
 	
 	canvas = document.getElementById('screen');
 	context = canvas.getContext('2d');
@@ -102,32 +222,76 @@ const char* html = R"rawliteral(
 		console.log(msg);
 	}
 	
+	// Token para reassumir a célula depois de um reinício do servidor
+	function loadResumeToken() {
+		try {
+			return Number(window.localStorage.getItem('agario_resume')) || 0;
+		} catch(e) {
+			return 0;
+		}
+	}
+	
+	function saveResumeToken(token) {
+		try {
+			window.localStorage.setItem('agario_resume', String(token));
+		} catch(e) {}
+	}
+	
+	function sendJoin() {
+		ws.send(JSON.stringify({
+			type: 'join',
+			playerId: player_object_id,
+			name: player_name,
+			fillColor: objects.cells[player_object_id].fillColor,
+			strokeColor: objects.cells[player_object_id].strokeColor,
+			resume: loadResumeToken()
+		}));
+	}
+	
 	// Conectar ao WebSocket
 	function connectWebSocket() {
 		try {
 			updateDebug('Tentando conectar WebSocket...');
-			ws = new WebSocket('ws://' + window.location.hostname + ':81');
+			ws = new WebSocket('ws://' + server_host + ':81');
+			ws.binaryType = 'arraybuffer';
 			
 			ws.onopen = function() {
 				wsConnected = true;
 				updateDebug('WebSocket conectado!');
 				console.log('WebSocket conectado!');
+				
+				// Reconexão (queda ou handoff): entrar de novo com o token
+				if(player_name !== null) {
+					sendJoin();
+				}
 			};
 			
 			ws.onmessage = function(event) {
 				try {
-					var data = JSON.parse(event.data);
+					var data = JSON.parse(
+						(typeof event.data === 'string') ? event.data : decodeFrame(event.data)
+					);
 					
 					if(data.type === 'init') {
 						player_object_id = data.playerId;
 						if(objects.cells[player_object_id]) {
 							objects.cells[player_object_id].x = data.x;
 							objects.cells[player_object_id].y = data.y;
+							objects.cells[player_object_id].r = data.r;
+							pending_inputs = [];
 							player_world_position.x = data.x;
 							player_world_position.y = data.y;
-							updateDebug('Jogador inicializado: ' + player_object_id);
+							updateDebug((data.resumed ? 'Célula recuperada: ' : 'Jogador inicializado: ') + player_object_id);
+						}
+						if(data.resume) {
+							saveResumeToken(data.resume);
 						}
 					} else if(data.type === 'players') {
+						// Reconciliar a célula local com o estado do servidor
+						if(data.players[player_object_id] && objects.cells[player_object_id]) {
+							reconcilePlayer(data.players[player_object_id]);
+						}
+						
 						// Atualizar todos os jogadores
 						for(var id in data.players) {
 							if(id !== player_object_id) {
@@ -140,11 +304,14 @@ const char* html = R"rawliteral(
 									);
 									objects.cells[id].fillColor = data.players[id].fillColor;
 									objects.cells[id].strokeColor = data.players[id].strokeColor;
-								} else {
-									objects.cells[id].x = data.players[id].x;
-									objects.cells[id].y = data.players[id].y;
-									objects.cells[id].r = data.players[id].r;
 								}
+								
+								// Guardar snapshot; a posição é interpolada em update()
+								objects.cells[id].pushSnapshot(
+									data.players[id].x,
+									data.players[id].y,
+									data.players[id].r
+								);
 							}
 						}
 						
@@ -155,19 +322,40 @@ const char* html = R"rawliteral(
 							}
 						}
 					} else if(data.type === 'pellets') {
-						// Atualizar pellets
+						// Atualizar um bloco de pellets (mantendo o array denso)
+						var start = data.start || 0;
+						
+						while(objects.pellets.length < start) {
+							objects.pellets.push(new Pellet());
+						}
+						
 						for(var i = 0; i < data.pellets.length; i++) {
-							if(!objects.pellets[i]) {
-								objects.pellets[i] = new Pellet();
+							var pellet = objects.pellets[ start + i ];
+							
+							if(!pellet) {
+								pellet = objects.pellets[ start + i ] = new Pellet();
 							}
-							objects.pellets[i].x = data.pellets[i].x;
-							objects.pellets[i].y = data.pellets[i].y;
-							objects.pellets[i].r = data.pellets[i].r;
-							objects.pellets[i].color = data.pellets[i].color;
+							pellet.x = data.pellets[i].x;
+							pellet.y = data.pellets[i].y;
+							pellet.r = data.pellets[i].r;
+							pellet.color = data.pellets[i].color;
+						}
+					} else if(data.type === 'leaderboard') {
+						leaderboard = data.top;
+					} else if(data.type === 'handoff') {
+						// A célula passou para a região de outro servidor
+						saveResumeToken(data.resume);
+						server_host = data.host;
+						handoff_pending = true;
+						updateDebug('Handoff para ' + data.host);
+						ws.close();
+					} else if(data.type === 'playerLeft') {
+						if(data.playerId !== player_object_id) {
+							delete objects.cells[ data.playerId ];
 						}
 					} else if(data.type === 'playerEaten') {
 						if(data.eatenId === player_object_id) {
-							alert('Você foi comido por ' + data.eaterName + '!");
+							alert('Você foi comido por ' + data.eaterName + '!');
 							location.reload();
 						}
 					}
@@ -180,7 +368,8 @@ const char* html = R"rawliteral(
 				wsConnected = false;
 				updateDebug('WebSocket desconectado. Reconectando...');
 				console.log('WebSocket desconectado');
-				setTimeout(connectWebSocket, 2000);
+				setTimeout(connectWebSocket, handoff_pending ? 0 : 2000);
+				handoff_pending = false;
 			};
 			
 			ws.onerror = function(error) {
@@ -194,24 +383,103 @@ const char* html = R"rawliteral(
 		}
 	}
 	
-	function sendPlayerUpdate() {
-		if(ws && ws.readyState === WebSocket.OPEN && objects.cells[player_object_id]) {
+	// Frames binários: [tipo][tamanho original uint32 LE][fluxo LZSS]
+	function decodeFrame(buffer) {
+		var bytes = new Uint8Array(buffer);
+		
+		if((bytes[0] & ~FRAME_REPLACEABLE) !== LZSS_FRAME) {
+			throw new Error('Frame binário desconhecido: ' + bytes[0]);
+		}
+		
+		var out_len = (bytes[1] | (bytes[2] << 8) | (bytes[3] << 16) | (bytes[4] << 24)) >>> 0;
+		
+		return text_decoder.decode(lzssDecode(bytes, 5, out_len));
+	}
+	
+	// Mesmo formato de lzss.h no servidor
+	function lzssDecode(src, offset, out_len) {
+		var out = new Uint8Array(out_len),
+			o = 0,
+			bit_pos = offset * 8;
+		
+		function bits(n) {
+			var v = 0;
+			
+			while(n--) {
+				v = (v << 1) | ((src[ bit_pos >> 3 ] >> (7 - (bit_pos & 7))) & 1);
+				bit_pos++;
+			}
+			
+			return v;
+		}
+		
+		while(o < out_len) {
+			if(bits(1)) {
+				out[ o++ ] = bits(8);
+			} else {
+				var dist = bits(LZSS_WINDOW_BITS) + 1,
+					len = bits(LZSS_LENGTH_BITS) + LZSS_MIN_MATCH;
+				
+				for(; len > 0 && o < out_len; len--, o++) {
+					out[ o ] = out[ o - dist ];
+				}
+			}
+		}
+		
+		return out;
+	}
+	
+	function sendPlayerInput(input) {
+		if(ws && ws.readyState === WebSocket.OPEN) {
 			try {
 				ws.send(JSON.stringify({
-					type: 'update',
+					type: 'input',
 					playerId: player_object_id,
-					x: objects.cells[player_object_id].x,
-					y: objects.cells[player_object_id].y,
-					r: objects.cells[player_object_id].r,
-					mx: objects.cells[player_object_id].mx,
-					my: objects.cells[player_object_id].my
+					seq: input.seq,
+					mx: input.mx,
+					my: input.my,
+					dt: input.dt
 				}));
 			} catch(e) {
-				console.error('Erro ao enviar update:', e);
+				console.error('Erro ao enviar input:', e);
 			}
 		}
 	}
 	
+	// Predição local: aplica o input já e guarda até o servidor confirmar
+	function applyLocalInput(mx, my, dt) {
+		var input = {
+			'seq':	++input_sequence,
+			'mx':	mx,
+			'my':	my,
+			'dt':	Math.min(dt, 0.25)
+		};
+		
+		objects.cells[ player_object_id ].move(input.mx, input.my, input.dt);
+		
+		if(ws && ws.readyState === WebSocket.OPEN) {
+			pending_inputs.push(input);
+			sendPlayerInput(input);
+		}
+	}
+	
+	// Reconciliação: parte do estado autoritativo e reaplica os inputs não confirmados
+	function reconcilePlayer(state) {
+		var cell = objects.cells[ player_object_id ];
+		
+		cell.x = state.x;
+		cell.y = state.y;
+		cell.r = state.r;
+		
+		while(pending_inputs.length > 0 && pending_inputs[0].seq <= state.ack) {
+			pending_inputs.shift();
+		}
+		
+		for(var i = 0; i < pending_inputs.length; i++) {
+			cell.move(pending_inputs[i].mx, pending_inputs[i].my, pending_inputs[i].dt);
+		}
+	}
+	
 	function randomBetween(min, max) {
 		return Math.floor(Math.random()*(max-min+1)+min);
 	}
@@ -279,7 +547,6 @@ const char* html = R"rawliteral(
 	function Pellet() {
 		this.refreshPosition();
 		this.refreshColor();
-		this.refreshDisplay();
 	}
 	
 	Pellet.prototype = {
@@ -288,22 +555,12 @@ const char* html = R"rawliteral(
 		'r':			0,
 		'color':		"",
 		'lineWidth':	10,
-		'angle':		0,
-		'num_points':	6,
-		'lastAngleChg':	0,
-		'chgAngleAftr':	1,
 		
 		'refreshPosition': function(x, y, r) {
 			this.r = r || 1;
 			
 			this.x = x || randomBetween((this.r + this.lineWidth), (world_size.x - (this.r + this.lineWidth)));
-			this.y = r || randomBetween((this.r + this.lineWidth), (world_size.y - (this.r + this.lineWidth)));
-		},
-		
-		'refreshDisplay': function(change_color) {
-			this.angle = randomBetween(0, 359);
-			this.num_points = randomBetween(8, 9);
-			this.chgAngleAftr = randomBetween(1, 5);
+			this.y = y || randomBetween((this.r + this.lineWidth), (world_size.y - (this.r + this.lineWidth)));
 		},
 		
 		'refreshColor': function() {
@@ -312,56 +569,79 @@ const char* html = R"rawliteral(
 			this.color = "rgb("+ newColor.join(",") +")";
 		},
 		
-		'update': function(dt) {
-			// Pellets são gerenciados pelo servidor agora
-			this.lastAngleChg += dt;
-		},
-		
+		// Desenha a partir do sprite pré-rasterizado da cor (sem path por frame)
 		'draw': function() {
-			context.save();
-			
-			context.translate(worldXToCameraX(this.x), worldYToCameraY(this.y));
-			
-			if(this.lastAngleChg >= this.chgAngleAftr) {
-				this.refreshDisplay();
-				
-				this.lastAngleChg = 0;
-			}
-			
-			context.rotate((this.angle * (Math.PI / 180)));
-			
-			var per_point = (360 / (this.num_points + 1));
+			var slot = getPelletSprite(this.color),
+				size = pellet_sprites.size,
+				scale = (this.r + this.lineWidth) / (1 + this.lineWidth),
+				half = (size * scale) / 2;
 			
-			context.beginPath();
-			context.moveTo((this.r + this.lineWidth), 0);
-			
-			var angle_rad, next_x, nexy_y;
-			
-			for(var i = 1; i <= this.num_points; i++) {
-				angle_rad = (Math.PI * ((per_point * i) / 180));
-				next_x = ((this.r + this.lineWidth) * Math.cos(angle_rad));
-				next_y = ((this.r + this.lineWidth) * Math.sin(angle_rad));
-				
-				context.lineTo(next_x, next_y);
-			}
-			
-			context.closePath();
-			
-			context.fillStyle = this.color;
-			context.fill();
-			
-			context.restore();
+			context.drawImage(
+				pellet_sprites.canvas,
+				(slot * size), 0, size, size,
+				(worldXToCameraX(this.x) - half), (worldYToCameraY(this.y) - half), (size * scale), (size * scale)
+			);
 		},
 		
 		'consume': function() {
 			this.refreshPosition();
 			this.refreshColor();
-			this.refreshDisplay();
 			
 			return this.r;
 		}
 	};
 	
+	// Atlas de sprites dos pellets: um quadro por cor, rasterizado uma única vez
+	function getPelletSprite(color) {
+		var slot = pellet_sprites.slots[ color ];
+		
+		if(slot !== undefined) {
+			return slot;
+		}
+		
+		var radius = (1 + Pellet.prototype.lineWidth),
+			size = (radius * 2) + 2,
+			old = pellet_sprites.canvas,
+			atlas = document.createElement('canvas');
+		
+		slot = pellet_sprites.count;
+		
+		atlas.width = size * (slot + 1);
+		atlas.height = size;
+		
+		var atlas_context = atlas.getContext('2d');
+		
+		if(old) {
+			atlas_context.drawImage(old, 0, 0);
+		}
+		
+		var num_points = 8,
+			per_point = (360 / (num_points + 1));
+		
+		atlas_context.save();
+		atlas_context.translate(((slot * size) + (size / 2)), (size / 2));
+		atlas_context.beginPath();
+		atlas_context.moveTo(radius, 0);
+		
+		for(var i = 1; i <= num_points; i++) {
+			var angle_rad = (Math.PI * ((per_point * i) / 180));
+			
+			atlas_context.lineTo((radius * Math.cos(angle_rad)), (radius * Math.sin(angle_rad)));
+		}
+		
+		atlas_context.closePath();
+		atlas_context.fillStyle = color;
+		atlas_context.fill();
+		atlas_context.restore();
+		
+		pellet_sprites.canvas = atlas;
+		pellet_sprites.size = size;
+		pellet_sprites.slots[ color ] = slot;
+		pellet_sprites.count += 1;
+		
+		return slot;
+	}
+	
 	function Cell(x, y, radius, name) {
 		var newFillColor = chooseRandomColor();
 		var newStrokeColor = darkenColor(newFillColor);
@@ -372,6 +652,7 @@ const char* html = R"rawliteral(
 		this.fillColor = "rgb("+ newFillColor.join(",") +")";
 		this.strokeColor = "rgb("+ newStrokeColor.join(",") +")";
 		this.name = name;
+		this.snapshots = [];
 	}
 	
 	Cell.prototype = {
@@ -389,50 +670,70 @@ const char* html = R"rawliteral(
 		'decreaseAfter':	5,
 		'subcells':			[[100, 0, 0]],
 		'maxSubcells':		16,
+		'snapshots':		null,
 		
-		'update': function(dt) {
-			if((this.mx != 0) || (this.my != 0)) {
-				var speed = (fastest_cell_speed * (20 / (this.r + this.lineWidth)));
-				
-				if(this.mx != 0) {
-					this.x += (this.mx * speed * dt);
-					
-					this.x = Math.max(this.r, Math.min((world_size.x - this.r), this.x));
-				}
-				
-				if(this.my != 0) {
-					this.y += (this.my * speed * dt);
-					
-					this.y = Math.max(this.r, Math.min((world_size.y - this.r), this.y));
-				}
-				
-				this.mx = 0;
-				this.my = 0;
+		'pushSnapshot': function(x, y, r) {
+			this.snapshots.push({'t': performance.now(), 'x': x, 'y': y, 'r': r});
+			
+			if(this.snapshots.length > snapshot_buffer_max) {
+				this.snapshots.shift();
 			}
+		},
+		
+		'interpolate': function(render_time) {
+			var snaps = this.snapshots;
 			
-			this.decreaseTime += dt;
+			if(snaps.length == 0) {
+				return;
+			}
+			
+			// Descartar snapshots que já ficaram para trás do instante renderizado
+			while(snaps.length >= 2 && snaps[1].t <= render_time) {
+				snaps.shift();
+			}
 			
-			if(this.decreaseTime >= this.decreaseAfter) {
-				var decreaseTimes = Math.floor( (this.decreaseTime / this.decreaseAfter) ),
-					decreaseAmount = 1;
+			var a = snaps[0];
+			
+			if(snaps.length == 1 || render_time <= a.t) {
+				// Sem par para interpolar: segura o último estado conhecido
+				this.x = a.x;
+				this.y = a.y;
+				this.r = a.r;
+				return;
+			}
+			
+			var b = snaps[1],
+				k = (render_time - a.t) / (b.t - a.t);
+			
+			this.x = a.x + ((b.x - a.x) * k);
+			this.y = a.y + ((b.y - a.y) * k);
+			this.r = a.r + ((b.r - a.r) * k);
+		},
+		
+		// Mesma integração de applyInput() no servidor
+		'move': function(mx, my, dt) {
+			var speed = (fastest_cell_speed * (20 / (this.r + this.lineWidth)));
+			
+			if(mx != 0) {
+				this.x += (mx * speed * dt);
 				
-				if(this.r > 1000) {
-					decreaseAmount = 5;
-				} else if(this.r > 250) {
-					decreaseAmount = 3;
-				}
+				this.x = Math.max(this.r, Math.min((world_size.x - this.r), this.x));
+			}
+			
+			if(my != 0) {
+				this.y += (my * speed * dt);
 				
-				this.decreaseTime %= this.decreaseAfter;
+				this.y = Math.max(this.r, Math.min((world_size.y - this.r), this.y));
+			}
+		},
+		
+		// A perda de massa é calculada pelo servidor (gameTick)
+		'update': function(dt) {
+			if((this.mx != 0) || (this.my != 0)) {
+				applyLocalInput(this.mx, this.my, dt);
 				
-				for(var i = 1; i <= decreaseTimes; i++) {
-					this.r = (this.r * ((100 - decreaseAmount) / 100));
-					
-					if(this.r < this.rMin) {
-						this.r = this.rMin;
-						
-						break;
-					}
-				}
+				this.mx = 0;
+				this.my = 0;
 			}
 		},
 		
@@ -532,46 +833,102 @@ const char* html = R"rawliteral(
 		}
 	};
 	
+	// Retângulo visível em coordenadas do mundo (com margem para o contorno)
+	function updateViewRect() {
+		var margin = 50,
+			half_w = (window_halfWidth / camera_scale) + margin,
+			half_h = (window_halfHeight / camera_scale) + margin;
+		
+		view_rect.left = player_world_position.x - half_w;
+		view_rect.right = player_world_position.x + half_w;
+		view_rect.top = player_world_position.y - half_h;
+		view_rect.bottom = player_world_position.y + half_h;
+	}
+	
+	function isVisible(x, y, r) {
+		return (
+			(x + r) >= view_rect.left && (x - r) <= view_rect.right &&
+			(y + r) >= view_rect.top && (y - r) <= view_rect.bottom
+		);
+	}
+	
 	function draw_grid() {
 		var grid_size = 20;
 		
+		if(!grid_pattern) {
+			var tile = document.createElement('canvas');
+			
+			tile.width = grid_size;
+			tile.height = grid_size;
+			
+			var tile_context = tile.getContext('2d');
+			
+			tile_context.fillStyle = "#dee6ea";
+			tile_context.fillRect(0, 0, grid_size, 1);
+			tile_context.fillRect(0, 0, 1, grid_size);
+			
+			grid_pattern = context.createPattern(tile, 'repeat');
+		}
+		
 		context.save();
 		
-		context.translate(((window_halfWidth / camera_scale) * -1), ((window_halfHeight / camera_scale) * -1));
+		// Padrão ancorado na origem do mundo, preenchendo só a área visível
+		context.translate(worldXToCameraX(0), worldYToCameraY(0));
+		
+		context.fillStyle = grid_pattern;
+		context.fillRect(
+			view_rect.left,
+			view_rect.top,
+			(view_rect.right - view_rect.left),
+			(view_rect.bottom - view_rect.top)
+		);
 		
-		var scaled_canvas_width = (window_width / camera_scale);
-		var scaled_canvas_height = (window_height / camera_scale);
+		context.restore();
+	}
+	
+	// Ranking global do servidor, em coordenadas de tela
+	function draw_leaderboard() {
+		if(leaderboard.length === 0) {
+			return;
+		}
 		
-		var grid_start_x = 0;
-		var grid_start_y = 0;
+		var fontSize = 14,
+			lineHeight = 20,
+			boxPadding = 8,
+			boxWidth = 190,
+			boxX = 10,
+			boxY = 40;
 		
-		grid_start_x -= ( ( (window_halfWidth / camera_scale) * -1 ) % grid_size );
-		grid_start_y -= ( ( (window_halfHeight / camera_scale) * -1 ) % grid_size );
+		context.save();
 		
-		grid_start_x -= ( ( worldXToCameraX(camera_position.x) * -1 ) % grid_size );
-		grid_start_y -= ( ( worldYToCameraY(camera_position.y) * -1 ) % grid_size );
+		context.setTransform(1, 0, 0, 1, 0, 0);
 		
 		context.beginPath();
-		context.lineWidth = 1;
-		context.strokeStyle = "#dee6ea";
 		
-		for(var grid_x = grid_start_x; grid_x <= scaled_canvas_width; grid_x += grid_size) {
-			context.moveTo(grid_x, 0);
-			context.lineTo(grid_x, scaled_canvas_height);
-		}
+		context.rect(boxX, boxY, boxWidth, (boxPadding + (lineHeight * (leaderboard.length + 1)) + boxPadding));
+		context.fillStyle = "rgba(0, 0, 0, 0.3)";
+		context.fill();
 		
-		for(var grid_y = grid_start_y; grid_y <= scaled_canvas_height; grid_y += grid_size) {
-			context.moveTo(0, grid_y);
-			context.lineTo(scaled_canvas_width, grid_y);
-		}
+		context.textBaseline = "hanging";
+		context.font = "bold "+ fontSize +"px Verdana";
+		context.fillStyle = "#ffffff";
+		context.textAlign = "left";
+		context.fillText("Ranking", (boxX + boxPadding), (boxY + boxPadding));
 		
-		context.stroke();
+		context.font = "normal "+ fontSize +"px Verdana";
 		
-		context.restore();
-	}
-	
-	function draw_leaderboard() {
+		for(var i = 0; i < leaderboard.length; i++) {
+			var entry = leaderboard[ i ],
+				lineY = (boxY + boxPadding + (lineHeight * (i + 1)));
+			
+			context.fillStyle = (entry.id === player_object_id) ? "#ffd700" : "#ffffff";
+			context.textAlign = "left";
+			context.fillText((i + 1) +". "+ String(entry.name).substring(0, 14), (boxX + boxPadding), lineY);
+			context.textAlign = "right";
+			context.fillText(entry.r, (boxX + boxWidth - boxPadding), lineY);
+		}
 		
+		context.restore();
 	}
 	
 	function draw_player_score() {
@@ -660,22 +1017,46 @@ const char* html = R"rawliteral(
 				objects.cells[ player_object_id ].my = Math.sin(angleFromPlayer);
 			}
 			
-			for(var obj in objects.cells) {
-				objects.cells[ obj ].update(dt);
-			}
+			var render_time = performance.now() - interpolation_delay;
 			
-			for(var obj in objects.pellets) {
-				objects.pellets[ obj ].update(dt);
+			for(var obj in objects.cells) {
+				if(obj !== player_object_id) {
+					objects.cells[ obj ].interpolate(render_time);
+				} else {
+					objects.cells[ obj ].update(dt);
+				}
 			}
 			
 			player_world_position.x = objects.cells[ player_object_id ].x;
 			player_world_position.y = objects.cells[ player_object_id ].y;
 			
 			camera_position = worldXYToCameraXY(player_world_position.x, player_world_position.y);
+		} else if(spectator) {
+			update_spectator();
+		}
+	}
+	
+	// Espectador: todas as células interpoladas, câmera na maior
+	function update_spectator() {
+		var render_time = performance.now() - interpolation_delay,
+			biggest = null;
+		
+		for(var obj in objects.cells) {
+			var cell = objects.cells[ obj ];
 			
-			// Enviar atualização do jogador
-			sendPlayerUpdate();
+			cell.interpolate(render_time);
+			
+			if(!biggest || cell.r > biggest.r) {
+				biggest = cell;
+			}
+		}
+		
+		if(biggest) {
+			player_world_position.x = biggest.x;
+			player_world_position.y = biggest.y;
 		}
+		
+		camera_position = worldXYToCameraXY(player_world_position.x, player_world_position.y);
 	}
 	
 	function draw() {
@@ -686,15 +1067,29 @@ const char* html = R"rawliteral(
 		context.translate((camera_position.x + window_halfWidth), (camera_position.y + window_halfHeight));
 		context.scale(camera_scale, camera_scale);
 		
+		updateViewRect();
+		
 		draw_grid();
 		draw_world_border();
 		
-		for(var obj in objects.pellets) {
-			objects.pellets[ obj ].draw();
+		var pellets = objects.pellets,
+			pellets_drawn = 0;
+		
+		for(var i = 0, n = pellets.length; i < n; i++) {
+			if(isVisible(pellets[ i ].x, pellets[ i ].y, (pellets[ i ].r + pellets[ i ].lineWidth))) {
+				pellets[ i ].draw();
+				pellets_drawn++;
+			}
 		}
 		
+		frame_stats.pellets_drawn = pellets_drawn;
+		
 		for(var obj in objects.cells) {
-			objects.cells[ obj ].draw();
+			var cell = objects.cells[ obj ];
+			
+			if(isVisible(cell.x, cell.y, (cell.r + cell.lineWidth + 100))) {
+				cell.draw();
+			}
 		}
 		
 		draw_leaderboard();
@@ -708,6 +1103,71 @@ const char* html = R"rawliteral(
 		context.restore();
 	}
 	
+	function update_debug_overlay(dt) {
+		debug_overlay_time += dt;
+		
+		if(debug_overlay_time < 0.5) {
+			return;
+		}
+		
+		debug_overlay_time = 0;
+		
+		var remotes = 0, depth_min = Infinity, depth_max = 0, depth_sum = 0;
+		
+		for(var id in objects.cells) {
+			if(id === player_object_id) {
+				continue;
+			}
+			
+			var depth = objects.cells[ id ].snapshots.length;
+			
+			remotes += 1;
+			depth_sum += depth;
+			depth_min = Math.min(depth_min, depth);
+			depth_max = Math.max(depth_max, depth);
+		}
+		
+		// Histograma do intervalo entre frames desde o último relatório
+		var histogram = '',
+			labels = ['<8', '8-16', '16-33', '33-50', '50-100', '>100'],
+			frames = Math.max(1, frame_stats.frames);
+		
+		for(var b = 0; b < frame_stats.buckets.length; b++) {
+			var pct = Math.round((frame_stats.buckets[ b ] * 100) / frames);
+			
+			histogram += '<br>' + ('      ' + labels[ b ]).slice(-6) + 'ms ' +
+				new Array(Math.round(pct / 5) + 1).join('#') + ' ' + pct + '%';
+			
+			frame_stats.buckets[ b ] = 0;
+		}
+		
+		document.getElementById('debug').innerHTML =
+			(wsConnected ? 'Conectado' : 'Desconectado') +
+			'<br>Interp: ' + interpolation_delay + ' ms' +
+			'<br>Inputs pendentes: ' + pending_inputs.length +
+			'<br>Buffer: ' + (remotes ? (depth_min + '/' + (depth_sum / remotes).toFixed(1) + '/' + depth_max) : '-') +
+			' (min/méd/máx, ' + remotes + ' células)' +
+			'<br>FPS: ' + Math.floor(game_fps) +
+			' | frame: ' + (frame_stats.work_ms / frames).toFixed(2) + ' ms' +
+			'<br>Pellets: ' + frame_stats.pellets_drawn + '/' + objects.pellets.length +
+			'<pre style="margin:0">' + histogram + '</pre>';
+		
+		frame_stats.frames = 0;
+		frame_stats.work_ms = 0;
+	}
+	
+	function recordFrameTime(interval_ms, work_ms) {
+		var b = 0;
+		
+		while(b < frame_stats.limits.length && interval_ms >= frame_stats.limits[ b ]) {
+			b++;
+		}
+		
+		frame_stats.buckets[ b ] += 1;
+		frame_stats.work_ms += work_ms;
+		frame_stats.frames += 1;
+	}
+	
 	var loop__time = new Date().getTime();
 	var fps = 0, last_fps = 0;
 	
@@ -730,29 +1190,40 @@ const char* html = R"rawliteral(
 		loop__time = now;
 		
 		if(can_render) {
+			var work_start = performance.now();
+			
 			update(dt);
 			draw();
+			
+			recordFrameTime((dt * 1000), (performance.now() - work_start));
 		}
+		
+		update_debug_overlay(dt);
 	}
 	
 	window.onload = function() {
 		try {
 			updateDebug('Inicializando jogo...');
 			
-			player_object_id = Math.floor((Math.random() * 10000));
-			player_object_id = player_object_id.toString();
-			
-			var playerName = prompt("Digite seu nome:") || "Player_"+ player_object_id;
-			
-			updateDebug('Criando jogador: ' + playerName);
-			
-			objects.cells[ player_object_id ] = new Cell(player_world_position.x, player_world_position.y, 15, playerName);
+			if(spectator) {
+				player_object_id = null;
+				updateDebug('Modo espectador');
+			} else {
+				player_object_id = Math.floor((Math.random() * 10000));
+				player_object_id = player_object_id.toString();
+				
+				var playerName = prompt("Digite seu nome:") || "Player_"+ player_object_id;
+				
+				updateDebug('Criando jogador: ' + playerName);
+				
+				objects.cells[ player_object_id ] = new Cell(player_world_position.x, player_world_position.y, 15, playerName);
+			}
 			
 			camera_position = worldXYToCameraXY(player_world_position.x, player_world_position.y);
 			
 			// Criar alguns pellets localmente para visualização inicial
 			for(var i = 0; i < 100; i++) {
-				objects.pellets[i] = new Pellet();
+				objects.pellets.push(new Pellet());
 			}
 			
 			updateDebug('Conectando ao servidor...');
@@ -760,17 +1231,16 @@ const char* html = R"rawliteral(
 			// Conectar ao servidor WebSocket
 			connectWebSocket();
 			
-			// Enviar nome do jogador
+			// Enviar nome do jogador (espectadores não entram)
 			setTimeout(function() {
+				if(spectator) {
+					return;
+				}
+				
 				if(ws && ws.readyState === WebSocket.OPEN) {
 					try {
-						ws.send(JSON.stringify({
-							type: 'join',
-							playerId: player_object_id,
-							name: playerName,
-							fillColor: objects.cells[player_object_id].fillColor,
-							strokeColor: objects.cells[player_object_id].strokeColor
-						}));
+						player_name = playerName;
+						sendJoin();
 						updateDebug('Dados enviados ao servidor');
 					} catch(e) {
 						updateDebug('Erro ao enviar join: ' + e.message);
@@ -885,228 +1355,675 @@ void handleRoot() {
   server.send(200, "text/html", html);
 }
 
-// Inicializar pellets
-void initPellets() {
-  if (!pelletsInitialized) {
-    for (int i = 0; i < 1000; i++) {
-      pellets[i].x = random(10, 4990);
-      pellets[i].y = random(10, 4990);
-      pellets[i].r = 1;
-      pellets[i].numPoints = random(8, 10);
-      pellets[i].angle = random(0, 360);
-      
-      int colorIdx = random(0, 9);
-      int colors[9][3] = {
-        {255, 130, 7}, {255, 7, 139}, {254, 255, 0},
-        {7, 255, 171}, {255, 14, 7}, {81, 255, 7},
-        {7, 191, 255}, {7, 133, 255}, {205, 7, 255}
-      };
-      pellets[i].color = "rgb(" + String(colors[colorIdx][0]) + "," + 
-                         String(colors[colorIdx][1]) + "," + 
-                         String(colors[colorIdx][2]) + ")";
+uint32_t bootSeed() {
+  return WORLD_SEED ? WORLD_SEED : esp_random();
+}
+
+// Mapa de shards
+IPAddress shardAddress(int shard) {
+  return (shard == 0) ? IPAddress(192, 168, 4, 1) : IPAddress(192, 168, 4, SHARD_IP_BASE + shard);
+}
+
+unsigned long gameMillis() {
+  return gameClock;
+}
+
+// Esvaziar o buffer de gravação no arquivo
+void flushRecording() {
+  if (recorder.length() == 0) {
+    return;
+  }
+  recordFile.write(recorder.data(), recorder.length());
+  recordedBytes += recorder.length();
+  recorder.clear();
+}
+
+// A gravação precisa começar com o mundo recém-criado (ver resetWorld)
+void startRecording() {
+  recordFile = SPIFFS.open(RECORD_FILE, FILE_WRITE);
+  if (!recordFile) {
+    Serial.println("Erro ao criar " RECORD_FILE);
+    return;
+  }
+  recorder.clear();
+  recorder.writeHeader(world.seed);
+  recordedBytes = 0;
+  recording = true;
+  Serial.printf("Gravando sessão em %s (semente %u)\n", RECORD_FILE, (unsigned)world.seed);
+}
+
+void stopRecording() {
+  if (!recording) {
+    return;
+  }
+  flushRecording();
+  recordFile.close();
+  recording = false;
+  Serial.printf("Gravação encerrada: %u bytes\n", (unsigned)recordedBytes);
+}
+
+void recordEvent(uint8_t type, uint8_t client, const uint8_t* payload, size_t length) {
+  // Mensagens acima do limite são descartadas sem parse: não mudam o mundo
+  if (!recording || length > RECORDING_MAX_PAYLOAD) {
+    return;
+  }
+  
+  size_t needed = RecordingWriter::maxEventSize(length);
+  if (recorder.remaining() < needed) {
+    flushRecording();
+  }
+  if (recordedBytes + recorder.length() + needed > RECORD_MAX_BYTES) {
+    Serial.println("Gravação atingiu o limite de tamanho");
+    stopRecording();
+    return;
+  }
+  recorder.append(gameMillis(), type, client, payload, length);
+}
+
+// Copiar o estado para o staging: só RAM, rápido o bastante para o tick
+void captureSnapshot() {
+  unsigned long start = micros();
+  size_t pos = sizeof(SnapshotHeader);
+  
+  for (int i = 0; i < MAX_PELLETS; i++) {
+    SnapshotPellet pellet = { (int16_t)world.pellets[i].x, (int16_t)world.pellets[i].y,
+                              (uint8_t)world.pellets[i].r, world.pellets[i].color };
+    memcpy(snapshotBuffer + pos, &pellet, sizeof(pellet));
+    pos += sizeof(pellet);
+  }
+  
+  // Humanos em jogo e quem ainda não voltou do último reinício
+  int saved = 0;
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    if (world.players[i].active && !world.players[i].isBot) {
+      SnapshotPlayer player = { world.players[i].resumeToken, world.players[i].x, world.players[i].y, world.players[i].r };
+      memcpy(snapshotBuffer + pos, &player, sizeof(player));
+      pos += sizeof(player);
+      saved++;
+    }
+  }
+  for (int k = 0; k < MAX_PLAYERS && saved < MAX_PLAYERS; k++) {
+    if (resumeSlots[k].player.resumeToken != 0 && (long)(millis() - resumeSlots[k].expires) < 0) {
+      memcpy(snapshotBuffer + pos, &resumeSlots[k].player, sizeof(SnapshotPlayer));
+      pos += sizeof(SnapshotPlayer);
+      saved++;
+    }
+  }
+  
+  SnapshotHeader header;
+  header.magic = SNAPSHOT_MAGIC;
+  header.seq = snapshotSeq;
+  header.worldSeed = world.seed;
+  header.rngState = world.rngState;
+  header.length = pos + sizeof(uint32_t);
+  header.pelletCount = MAX_PELLETS;
+  header.playerCount = saved;
+  memcpy(snapshotBuffer, &header, sizeof(header));
+  
+  snapshotLength = pos;
+  snapStats.captureMicros = micros() - start;
+}
+
+// Chamado a cada tick: captura a cada SNAPSHOT_INTERVAL e depois grava um
+// pedaço por tick; o CRC vai no fim, então arquivo pela metade é rejeitado
+void snapshotStep() {
+  if (!snapshotWriting) {
+    if (millis() - lastSnapshot < SNAPSHOT_INTERVAL) {
+      return;
+    }
+    lastSnapshot = millis();
+    
+    snapshotSeq++;
+    captureSnapshot();
+    snapshotFile = SPIFFS.open(snapshotFiles[snapshotSeq & 1], FILE_WRITE);
+    if (!snapshotFile) {
+      Serial.println("Erro ao criar o arquivo de snapshot");
+      return;
     }
-    pelletsInitialized = true;
+    snapshotWritten = 0;
+    snapshotCrc = 0;
+    snapshotWriting = true;
+    return;
+  }
+  
+  unsigned long start = micros();
+  size_t n = min((size_t)SNAPSHOT_CHUNK, snapshotLength - snapshotWritten);
+  bool ok = snapshotFile.write(snapshotBuffer + snapshotWritten, n) == n;
+  snapshotCrc = crc32Update(snapshotCrc, snapshotBuffer + snapshotWritten, n);
+  snapshotWritten += n;
+  
+  if (ok && snapshotWritten == snapshotLength) {
+    ok = snapshotFile.write((uint8_t*)&snapshotCrc, sizeof(snapshotCrc)) == sizeof(snapshotCrc);
+    snapshotFile.close();
+    snapshotWriting = false;
+    snapStats.writes++;
+    snapStats.bytes = snapshotLength + sizeof(snapshotCrc);
+  }
+  if (!ok) {
+    Serial.println("Erro ao gravar snapshot");
+    snapshotFile.close();
+    snapshotWriting = false;
+  }
+  snapStats.maxChunkMicros = max(snapStats.maxChunkMicros, (uint32_t)(micros() - start));
+}
+
+uint32_t snapshotFileSeq(const char* path) {
+  SnapshotHeader header;
+  File file = SPIFFS.open(path, FILE_READ);
+  if (!file) {
+    return 0;
   }
+  size_t len = file.read((uint8_t*)&header, sizeof(header));
+  file.close();
+  return (len == sizeof(header) && header.magic == SNAPSHOT_MAGIC) ? header.seq : 0;
+}
+
+// Ler um arquivo inteiro para o staging e conferir tamanho e CRC
+bool loadSnapshotFile(const char* path, SnapshotHeader& header) {
+  File file = SPIFFS.open(path, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  size_t len = file.read(snapshotBuffer, SNAPSHOT_MAX_SIZE);
+  file.close();
+  
+  if (len < sizeof(header) + sizeof(uint32_t)) {
+    return false;
+  }
+  memcpy(&header, snapshotBuffer, sizeof(header));
+  size_t expected = sizeof(header) + header.pelletCount * sizeof(SnapshotPellet)
+                    + header.playerCount * sizeof(SnapshotPlayer) + sizeof(uint32_t);
+  if (header.magic != SNAPSHOT_MAGIC || header.pelletCount != MAX_PELLETS ||
+      header.playerCount > MAX_PLAYERS || header.length != len || expected != len) {
+    return false;
+  }
+  
+  uint32_t crc;
+  memcpy(&crc, snapshotBuffer + len - sizeof(crc), sizeof(crc));
+  return crc == crc32Update(0, snapshotBuffer, len - sizeof(crc));
 }
 
-// Evento WebSocket
+// Boot: aplicar o snapshot íntegro mais novo sobre o mundo recém-criado
+void restoreSnapshot() {
+  unsigned long start = micros();
+  uint32_t seqs[2] = { snapshotFileSeq(snapshotFiles[0]), snapshotFileSeq(snapshotFiles[1]) };
+  int newest = (seqs[1] > seqs[0]) ? 1 : 0;
+  
+  SnapshotHeader header;
+  int used = -1;
+  for (int k = 0; k < 2 && used < 0; k++) {
+    int f = (k == 0) ? newest : 1 - newest;
+    if (seqs[f] != 0 && loadSnapshotFile(snapshotFiles[f], header)) {
+      used = f;
+    }
+  }
+  if (used < 0) {
+    Serial.println("Nenhum snapshot válido, mundo novo");
+    return;
+  }
+  
+  world.seed = header.worldSeed;
+  world.rngState = header.rngState;
+  
+  size_t pos = sizeof(SnapshotHeader);
+  world.pelletGrid.clear();
+  for (int i = 0; i < MAX_PELLETS; i++) {
+    SnapshotPellet pellet;
+    memcpy(&pellet, snapshotBuffer + pos, sizeof(pellet));
+    pos += sizeof(pellet);
+    world.pellets[i].x = pellet.x;
+    world.pellets[i].y = pellet.y;
+    world.pellets[i].r = pellet.r;
+    world.pellets[i].color = pellet.color % PELLET_COLOR_COUNT;
+    world.pelletGrid.insert(i, world.pellets[i].x, world.pellets[i].y);
+  }
+  
+  memset(resumeSlots, 0, sizeof(resumeSlots));
+  for (int k = 0; k < header.playerCount; k++) {
+    memcpy(&resumeSlots[k].player, snapshotBuffer + pos, sizeof(SnapshotPlayer));
+    pos += sizeof(SnapshotPlayer);
+    resumeSlots[k].since = millis();
+    resumeSlots[k].expires = millis() + RESUME_WINDOW;
+  }
+  snapshotSeq = max(seqs[0], seqs[1]);
+  
+  Serial.printf("Snapshot %u restaurado de %s: %u jogadores aguardando, %u us\n",
+                (unsigned)header.seq, snapshotFiles[used], (unsigned)header.playerCount,
+                (unsigned)(micros() - start));
+}
+
+// Jogador que volta com o token (reinício ou handoff) reassume a célula
+bool claimResume(int i, uint32_t token) {
+  if (token == 0) {
+    return false;
+  }
+  for (int k = 0; k < MAX_PLAYERS; k++) {
+    SnapshotPlayer& saved = resumeSlots[k].player;
+    if (saved.resumeToken == token && (long)(millis() - resumeSlots[k].expires) < 0) {
+      world.players[i].x = constrain(saved.x, 0, WORLD_SIZE);
+      world.players[i].y = constrain(saved.y, 0, WORLD_SIZE);
+      world.players[i].r = max((float)CELL_MIN_RADIUS, saved.r);
+      world.leaderboard.update(i, world.players[i].r);
+      world.players[i].spawnTick = world.tickCount;
+      world.players[i].resumeToken = token;
+      saved.resumeToken = 0;
+      shardNode.stats.resumes++;
+      shardNode.stats.resumeMillis += millis() - resumeSlots[k].since;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Avisos do mundo e do broadcaster para a rede
+void sendToAll(uint8_t* buf, size_t len, bool binary) {
+  if (binary) {
+    webSocket.broadcastBIN(buf, len, true);
+  } else {
+    webSocket.broadcastTXT(buf, len, true);
+  }
+}
+
+void onFrameMissing(size_t size) {
+  Serial.printf("Pool de frames sem buffer de %u bytes\n", (unsigned)size);
+}
+
+void onPlayerEaten(int eaten, const char* eaterId, const char* eaterName) {
+  broadcaster.playerEaten(eaten, eaterId, eaterName);
+}
+
+void onPlayerLeft(int i) {
+  broadcaster.playerLeft(i);
+}
+
+// Clientes que travaram sem fechar o TCP não respondem nem ao ping: o
+// slot já foi liberado, falta derrubar a conexão
+void onPlayerIdle(int i) {
+  uint8_t num = world.players[i].clientNum;
+  Serial.printf("[%u] Inativo há mais de %u ms, removendo %s\n",
+                num, (unsigned)PLAYER_TIMEOUT, world.players[i].id);
+  webSocket.disconnect(num);
+}
+
+void sendFrameTo(uint8_t num, Frame* frame) {
+  if (frame && !frame->overflow) {
+    webSocket.sendTXT(num, frame->buf, frame->len, true);
+  }
+}
+
+// Medir RTT: o payload do ping leva o millis() de envio e volta no pong
+void sendPings() {
+  if (gameMillis() - timers.lastPing < PING_INTERVAL) {
+    return;
+  }
+  timers.lastPing = gameMillis();
+  
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    if (world.players[i].active && !world.players[i].isBot) {
+      uint32_t now = millis();
+      webSocket.sendPing(world.players[i].clientNum, (uint8_t*)&now, sizeof(now));
+    }
+  }
+}
+
+void handleJoin(uint8_t num, JsonDocument& doc) {
+  // Novo jogador; um join repetido na mesma conexão reusa o slot dela
+  int i = joinFromMessage(world, num, doc);
+  if (i < 0) {
+    return;
+  }
+  
+  Player& player = world.players[i];
+  bool resumed = claimResume(i, doc["resume"] | 0u);
+  if (!resumed) {
+    world.spawnPlayer(i);
+    player.resumeToken = esp_random() | 1;
+  }
+  
+  // Enviar posição inicial
+  JsonDocument initDoc(&tickArena);
+  initDoc["type"] = "init";
+  initDoc["playerId"] = player.id;
+  initDoc["x"] = player.x;
+  initDoc["y"] = player.y;
+  initDoc["r"] = player.r;
+  initDoc["resume"] = player.resumeToken;
+  initDoc["resumed"] = resumed;
+  
+  Frame* frame = broadcaster.acquire(SMALL_FRAME_SIZE);
+  if (broadcaster.serialize(initDoc, frame)) {
+    sendFrameTo(num, frame);
+  }
+  
+  // Quem entra recebe o ranking atual; depois, só as mudanças
+  if (broadcaster.writeLeaderboard(frame)) {
+    sendFrameTo(num, frame);
+  }
+  broadcaster.release(frame);
+}
+
+// Tratar uma mensagem de texto sem criar Strings
+void handleMessage(uint8_t num, uint8_t* payload, size_t length) {
+  unsigned long start = micros();
+  
+  // Nenhuma mensagem válida passa disso; rejeitar antes de gastar o parser
+  if (length > MAX_MESSAGE_SIZE) {
+    rxStats.rejected++;
+    return;
+  }
+  
+  ArenaScope scope(tickArena);
+  JsonDocument doc(&tickArena);
+  DeserializationError error = deserializeJson(doc, payload, length,
+                                               DeserializationOption::Filter(inputFilter));
+  if (error) {
+    rxStats.rejected++;
+    return;
+  }
+  
+  switch (parseMessageType(doc["type"])) {
+    case MSG_JOIN:
+      handleJoin(num, doc);
+      break;
+    case MSG_INPUT:
+      inputFromMessage(world, num, doc);
+      break;
+    default:
+      rxStats.rejected++;
+      return;
+  }
+  
+  rxStats.count++;
+  rxStats.micros += micros() - start;
+}
+
+// Remover o jogador da conexão encerrada
+void handleDisconnect(uint8_t num) {
+  int i = world.findClient(num);
+  if (i >= 0) {
+    world.removePlayer(i);
+  }
+}
+
+void handlePong(uint8_t num, uint16_t rttMs) {
+  int i = world.findClient(num);
+  if (i >= 0) {
+    world.pong(i, rttMs);
+  }
+}
+
+// Evento WebSocket: tudo que muda o mundo passa antes pelo gravador
 void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
   switch(type) {
     case WStype_DISCONNECTED:
       Serial.printf("[%u] Desconectado!\n", num);
-      // Remover jogador
-      for (int i = 0; i < 10; i++) {
-        if (players[i].active && players[i].clientNum == num) {
-          players[i].active = false;
-          playerCount--;
-          break;
-        }
-      }
+      recordEvent(REC_DISCONNECTED, num, NULL, 0);
+      handleDisconnect(num);
       break;
       
     case WStype_CONNECTED:
       {
         IPAddress ip = webSocket.remoteIP(num);
         Serial.printf("[%u] Conectado de %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
+        recordEvent(REC_CONNECTED, num, NULL, 0);
       }
       break;
       
-    case WStype_TEXT:
-      {
-        StaticJsonDocument<512> doc;
-        deserializeJson(doc, payload);
-        
-        String type = doc["type"];
-        
-        if (type == "join") {
-          String playerId = doc["playerId"];
-          String name = doc["name"];
-          String fillColor = doc["fillColor"];
-          String strokeColor = doc["strokeColor"];
-          
-          // Adicionar novo jogador
-          for (int i = 0; i < 10; i++) {
-            if (!players[i].active) {
-              players[i].id = playerId;
-              players[i].name = name;
-              players[i].x = random(100, 4900);
-              players[i].y = random(100, 4900);
-              players[i].r = 15;
-              players[i].fillColor = fillColor;
-              players[i].strokeColor = strokeColor;
-              players[i].clientNum = num;
-              players[i].active = true;
-              players[i].lastUpdate = millis();
-              playerCount++;
-              
-              // Enviar posição inicial
-              StaticJsonDocument<200> initDoc;
-              initDoc["type"] = "init";
-              initDoc["playerId"] = playerId;
-              initDoc["x"] = players[i].x;
-              initDoc["y"] = players[i].y;
-              
-              String initMsg;
-              serializeJson(initDoc, initMsg);
-              webSocket.sendTXT(num, initMsg);
-              
-              break;
-            }
-          }
-        } else if (type == "update") {
-          String playerId = doc["playerId"];
-          float x = doc["x"];
-          float y = doc["y"];
-          float r = doc["r"];
-          
-          // Atualizar jogador
-          for (int i = 0; i < 10; i++) {
-            if (players[i].active && players[i].id == playerId) {
-              players[i].x = x;
-              players[i].y = y;
-              players[i].r = r;
-              players[i].lastUpdate = millis();
-              
-              // Verificar colisões com pellets
-              for (int p = 0; p < 1000; p++) {
-                float dx = players[i].x - pellets[p].x;
-                float dy = players[i].y - pellets[p].y;
-                float distance = sqrt(dx*dx + dy*dy);
-                
-                if (distance < (players[i].r + 5)) {
-                  players[i].r += pellets[p].r;
-                  // Reposicionar pellet
-                  pellets[p].x = random(10, 4990);
-                  pellets[p].y = random(10, 4990);
-                }
-              }
-              
-              // Verificar colisões com outros jogadores
-              for (int j = 0; j < 10; j++) {
-                if (i != j && players[j].active) {
-                  float dx = players[i].x - players[j].x;
-                  float dy = players[i].y - players[j].y;
-                  float distance = sqrt(dx*dx + dy*dy);
-                  
-                  // Se um jogador é 10% maior, pode comer o outro
-                  if (players[i].r > players[j].r * 1.1 && distance < players[i].r) {
-                    // Jogador i come jogador j
-                    players[i].r += (players[j].r * 0.8);
-                    
-                    // Notificar que o jogador foi comido
-                    StaticJsonDocument<200> eatenDoc;
-                    eatenDoc["type"] = "playerEaten";
-                    eatenDoc["eatenId"] = players[j].id;
-                    eatenDoc["eaterId"] = players[i].id;
-                    eatenDoc["eaterName"] = players[i].name;
-                    
-                    String eatenMsg;
-                    serializeJson(eatenDoc, eatenMsg);
-                    webSocket.broadcastTXT(eatenMsg);
-                    
-                    // Resetar jogador comido
-                    players[j].x = random(100, 4900);
-                    players[j].y = random(100, 4900);
-                    players[j].r = 15;
-                  } else if (players[j].r > players[i].r * 1.1 && distance < players[j].r) {
-                    // Jogador j come jogador i
-                    players[j].r += (players[i].r * 0.8);
-                    
-                    StaticJsonDocument<200> eatenDoc;
-                    eatenDoc["type"] = "playerEaten";
-                    eatenDoc["eatenId"] = players[i].id;
-                    eatenDoc["eaterId"] = players[j].id;
-                    eatenDoc["eaterName"] = players[j].name;
-                    
-                    String eatenMsg;
-                    serializeJson(eatenDoc, eatenMsg);
-                    webSocket.broadcastTXT(eatenMsg);
-                    
-                    players[i].x = random(100, 4900);
-                    players[i].y = random(100, 4900);
-                    players[i].r = 15;
-                  }
-                }
-              }
-              
-              break;
-            }
-          }
-        }
+    case WStype_PONG:
+      if (length == sizeof(uint32_t)) {
+        uint32_t sentAt;
+        memcpy(&sentAt, payload, sizeof(sentAt));
+        uint16_t rttMs = min((uint32_t)(millis() - sentAt), (uint32_t)UINT16_MAX);
+        uint8_t rttBytes[2] = { (uint8_t)(rttMs & 0xFF), (uint8_t)(rttMs >> 8) };
+        recordEvent(REC_PONG, num, rttBytes, sizeof(rttBytes));
+        handlePong(num, rttMs);
       }
       break;
+      
+    case WStype_TEXT:
+      recordEvent(REC_TEXT, num, payload, length);
+      handleMessage(num, payload, length);
+      break;
+  }
+}
+
+// Avisos do shardNode para o link e os clientes
+void sendShardPacket(int shard, const uint8_t* data, size_t len) {
+  shardLink.beginPacket(shardAddress(shard), SHARD_PORT);
+  shardLink.write(data, len);
+  shardLink.endPacket();
+}
+
+unsigned long wallMillis() {
+  return millis();
+}
+
+// O vizinho aceitou o humano i: mandá-lo reconectar lá com o token
+void onHandedOff(int i, int to) {
+  IPAddress ip = shardAddress(to);
+  char host[16];
+  snprintf(host, sizeof(host), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  
+  ArenaScope scope(tickArena);
+  JsonDocument doc(&tickArena);
+  doc["type"] = "handoff";
+  doc["host"] = host;
+  doc["resume"] = world.players[i].resumeToken;
+  
+  Frame* frame = broadcaster.acquire(SMALL_FRAME_SIZE);
+  if (broadcaster.serialize(doc, frame)) {
+    sendFrameTo(world.players[i].clientNum, frame);
+  }
+  broadcaster.release(frame);
+}
+
+// Humano vindo do vizinho espera num slot de resume até reconectar
+bool onHumanArrived(const ShardHandoff& msg) {
+  int k = 0;
+  while (k < MAX_PLAYERS && resumeSlots[k].player.resumeToken != 0 &&
+         (long)(millis() - resumeSlots[k].expires) < 0) {
+    k++;
+  }
+  if (k == MAX_PLAYERS) {
+    return false;
+  }
+  
+  SnapshotPlayer player = { msg.resumeToken, msg.state.x, msg.state.y, msg.state.r };
+  resumeSlots[k].player = player;
+  resumeSlots[k].since = millis();
+  resumeSlots[k].expires = millis() + HANDOFF_RESUME_MS;
+  return true;
+}
+
+// Ler tudo que chegou dos outros nós
+void pollShardLink() {
+  static uint8_t packet[SHARD_MAX_PACKET];
+  int len;
+  
+  while ((len = shardLink.parsePacket()) > 0) {
+    len = shardLink.read(packet, sizeof(packet));
+    if (len > 0) {
+      shardNode.receive(packet, len);
+    }
   }
 }
 
+// Recomeçar o mundo a partir de uma semente: mesma semente, mesmos
+// pellets, spawns e bots
+void resetWorld(uint32_t seed) {
+  world.reset(seed);
+  worldEpoch = millis();
+  gameClock = 0;
+  memset(&timers, 0, sizeof(timers));
+  broadcaster.reset();
+  tickArena.reset();
+  memset(resumeSlots, 0, sizeof(resumeSlots));
+}
+
+// Simulação periódica do servidor (perda de massa, histórico, RTT)
+void gameTick() {
+  if (gameMillis() - timers.lastTick < TICK_MS) {
+    return;
+  }
+  timers.lastTick = gameMillis();
+  unsigned long start = micros();
+  
+  // Nenhum documento sobrevive entre ticks
+  tickArena.reset();
+  
+  // Bots no orçamento de tempo; quantos decidiram vai no REC_TICK, e a
+  // reprodução repete a contagem sem depender do relógio
+  uint8_t thinks = world.tick(-1);
+  recordEvent(REC_TICK, 0, &thinks, sizeof(thinks));
+  sendPings();
+  world.reapIdlePlayers();
+#if SHARD_COUNT > 1
+  shardNode.tick();
+#endif
+  snapshotStep();
+  
+  uint32_t elapsed = micros() - start;
+  shardNode.stats.ticks++;
+  shardNode.stats.tickMicros += elapsed;
+  shardNode.stats.maxTickMicros = max(shardNode.stats.maxTickMicros, elapsed);
+}
+
+// Relatório periódico no serial
+void printStats() {
+  static unsigned long lastStats = 0;
+  
+  if (millis() - lastStats < STATS_INTERVAL) {
+    return;
+  }
+  lastStats = millis();
+  
+  CompressionStats& lzStats = broadcaster.lzStats;
+  if (lzStats.frames > 0) {
+    Serial.printf("LZSS: %u frames, %u -> %u bytes (%.1f%%), %u us/frame\n",
+                  (unsigned)lzStats.frames, (unsigned)lzStats.bytesIn, (unsigned)lzStats.bytesOut,
+                  100.0f * lzStats.bytesOut / lzStats.bytesIn,
+                  (unsigned)(lzStats.micros / lzStats.frames));
+  }
+  memset(&lzStats, 0, sizeof(lzStats));
+  
+  if (txStats.count > 0) {
+    Serial.printf("Broadcast: %u us/broadcast (max %u us)\n",
+                  (unsigned)(txStats.micros / txStats.count), (unsigned)txStats.maxMicros);
+  }
+  
+  // Fragmentação: maior bloco livre contra o total livre
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t largestBlock = ESP.getMaxAllocHeap();
+  // O mínimo vem com quantos clientes estavam conectados nele: é o número
+  // do heap a 10 clientes que a bancada no host (test_frame) não dá
+  Serial.printf("Heap: livre %u (min %u com %u clientes), maior bloco %u, fragmentação %u%%\n",
+                (unsigned)freeHeap, (unsigned)min(txStats.minFreeHeap, freeHeap),
+                (unsigned)txStats.clientsAtMin, (unsigned)largestBlock,
+                (unsigned)(freeHeap ? 100 - (100ULL * largestBlock / freeHeap) : 0));
+  if (rxStats.count > 0) {
+    Serial.printf("Entrada: %u msgs, %u us/msg (~%u msgs/s), %u rejeitadas\n",
+                  (unsigned)rxStats.count, (unsigned)(rxStats.micros / rxStats.count),
+                  (unsigned)(rxStats.micros ? 1000000ULL * rxStats.count / rxStats.micros : 0),
+                  (unsigned)rxStats.rejected);
+  }
+  memset(&rxStats, 0, sizeof(rxStats));
+  
+  BotStats& botStats = world.botStats;
+  if (botStats.ticks > 0) {
+    Serial.printf("Bots: %u us/tick (max %u us, orçamento %u us), %u decisões\n",
+                  (unsigned)(botStats.micros / botStats.ticks), (unsigned)botStats.maxMicros,
+                  (unsigned)BOT_BUDGET_US, (unsigned)botStats.decisions);
+  }
+  memset(&botStats, 0, sizeof(botStats));
+  
+  if (snapStats.writes > 0) {
+    Serial.printf("Snapshot: seq %u, %u bytes, cópia %u us, pedaço máx %u us\n",
+                  (unsigned)snapshotSeq, (unsigned)snapStats.bytes,
+                  (unsigned)snapStats.captureMicros, (unsigned)snapStats.maxChunkMicros);
+  }
+  memset(&snapStats, 0, sizeof(snapStats));
+  
+  if (shardNode.stats.ticks > 0) {
+    Serial.printf("Shard %u/%u: tick %u us (max %u us)\n", (unsigned)SHARD_ID, (unsigned)SHARD_COUNT,
+                  (unsigned)(shardNode.stats.tickMicros / shardNode.stats.ticks), (unsigned)shardNode.stats.maxTickMicros);
+  }
+#if SHARD_COUNT > 1
+  Serial.printf("Handoff: %u enviados (ack %u ms em média, max %u ms), %u falhas, %u recebidos\n",
+                (unsigned)shardNode.stats.handoffs,
+                (unsigned)(shardNode.stats.handoffs ? shardNode.stats.ackMillis / shardNode.stats.handoffs : 0),
+                (unsigned)shardNode.stats.maxAckMillis, (unsigned)shardNode.stats.failed,
+                (unsigned)shardNode.stats.received);
+  Serial.printf("Ghosts: %u comidos aqui, %u daqui comidos por ghosts\n",
+                (unsigned)shardNode.stats.ghostEats, (unsigned)shardNode.stats.eatenRemote);
+#endif
+  if (shardNode.stats.resumes > 0) {
+    Serial.printf("Resume: %u células reassumidas, %u ms até reconectar\n",
+                  (unsigned)shardNode.stats.resumes, (unsigned)(shardNode.stats.resumeMillis / shardNode.stats.resumes));
+  }
+  memset(&shardNode.stats, 0, sizeof(shardNode.stats));
+  
+  Serial.printf("Arena: pico %u/%u bytes, %u falhas\n",
+                (unsigned)tickArena.highWater(), (unsigned)tickArena.capacity(),
+                (unsigned)tickArena.failures());
+  tickArena.clearStats();
+  txStats.count = 0;
+  txStats.micros = 0;
+  txStats.maxMicros = 0;
+  txStats.minFreeHeap = UINT32_MAX;
+  txStats.clientsAtMin = 0;
+}
+
 // Broadcast estado do jogo
 void broadcastGameState() {
-  static unsigned long lastBroadcast = 0;
+#if SHARD_COUNT > 1
+  shardNode.expireGhosts();
+#endif
   
-  if (millis() - lastBroadcast > 50) { // 20 updates por segundo
-    // Enviar informações dos jogadores
-    StaticJsonDocument<2048> doc;
-    doc["type"] = "players";
-    JsonObject playersObj = doc.createNestedObject("players");
-    
-    for (int i = 0; i < 10; i++) {
-      if (players[i].active) {
-        JsonObject player = playersObj.createNestedObject(players[i].id);
-        player["x"] = players[i].x;
-        player["y"] = players[i].y;
-        player["r"] = players[i].r;
-        player["name"] = players[i].name;
-        player["fillColor"] = players[i].fillColor;
-        player["strokeColor"] = players[i].strokeColor;
-      }
-    }
-    
-    String msg;
-    serializeJson(doc, msg);
-    webSocket.broadcastTXT(msg);
-    
-    // Enviar informações dos pellets (menos frequente)
-    static int pelletUpdateCounter = 0;
-    if (pelletUpdateCounter % 10 == 0) {
-      StaticJsonDocument<4096> pelletDoc;
-      pelletDoc["type"] = "pellets";
-      JsonArray pelletsArray = pelletDoc.createNestedArray("pellets");
-      
-      for (int i = 0; i < 1000; i++) {
-        JsonObject pellet = pelletsArray.createNestedObject();
-        pellet["x"] = pellets[i].x;
-        pellet["y"] = pellets[i].y;
-        pellet["r"] = pellets[i].r;
-        pellet["color"] = pellets[i].color;
-      }
-      
-      String pelletMsg;
-      serializeJson(pelletDoc, pelletMsg);
-      webSocket.broadcastTXT(pelletMsg);
-    }
-    pelletUpdateCounter++;
-    
-    lastBroadcast = millis();
+  unsigned long start = micros();
+  if (!broadcaster.tick(gameMillis())) {
+    return;
+  }
+
+#if SHARD_COUNT > 1
+  shardNode.broadcast();
+#endif
+  
+  uint32_t elapsed = micros() - start;
+  txStats.count++;
+  txStats.micros += elapsed;
+  txStats.maxMicros = max(txStats.maxMicros, elapsed);
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < txStats.minFreeHeap) {
+    txStats.minFreeHeap = freeHeap;
+    txStats.clientsAtMin = webSocket.connectedClients();
+  }
+}
+
+// Endpoints de gravação; a reprodução roda no host (test/test_replay)
+void handleRecordStart() {
+  webSocket.disconnect();
+  stopRecording();
+  resetWorld(bootSeed());
+  startRecording();
+  server.send(200, "text/plain", recording ? "Gravando\n" : "Erro ao criar o arquivo\n");
+}
+
+void handleRecordStop() {
+  stopRecording();
+  server.send(200, "text/plain", String(recordedBytes) + " bytes gravados\n");
+}
+
+void handleRecordDownload() {
+  if (recording) {
+    flushRecording();
+  }
+  File file = SPIFFS.open(RECORD_FILE, FILE_READ);
+  if (!file) {
+    server.send(404, "text/plain", "Nenhuma gravação\n");
+    return;
   }
+  server.streamFile(file, "application/octet-stream");
+  file.close();
 }
 
 void setup() {
@@ -1119,34 +2036,82 @@ void setup() {
   }
   Serial.println("SPIFFS montado com sucesso");
   
-  // Inicializar array de jogadores
-  for (int i = 0; i < 10; i++) {
-    players[i].active = false;
-  }
+  // Avisos do mundo e do broadcaster
+  shardNode.begin();
+  world.hooks.clock = gameMillis;
+  world.hooks.micros = micros;
+  world.hooks.playerEaten = onPlayerEaten;
+  world.hooks.playerLeft = onPlayerLeft;
+  world.hooks.playerIdle = onPlayerIdle;
+  broadcaster.hooks.send = sendToAll;
+  broadcaster.hooks.micros = micros;
+  broadcaster.hooks.frameMissing = onFrameMissing;
+  shardNode.hooks.send = sendShardPacket;
+  shardNode.hooks.millis = wallMillis;
+  shardNode.hooks.handedOff = onHandedOff;
+  shardNode.hooks.humanArrived = onHumanArrived;
   
-  // Inicializar pellets
-  initPellets();
+  // Jogadores vazios e pellets a partir da semente; depois do reinício,
+  // o último snapshot (uma sessão gravada começa sempre do mundo novo)
+  resetWorld(bootSeed());
+#if !RECORD_SESSION
+  restoreSnapshot();
+#endif
   
-  // Configurar ESP32 como Access Point
-  Serial.println("Configurando Access Point...");
+  // Buffers de saída pré-alocados
+  if (!broadcaster.begin()) {
+    Serial.println("Pool de frames incompleto: sem memória");
+  }
+  buildInputFilter(inputFilter);
   
   IPAddress local_ip(192, 168, 4, 1);
   IPAddress gateway(192, 168, 4, 1);
   IPAddress subnet(255, 255, 255, 0);
   
-  WiFi.softAPConfig(local_ip, gateway, subnet);
-  WiFi.softAP(ap_ssid);
-  
-  IPAddress IP = WiFi.softAPIP();
-  Serial.println("Access Point iniciado!");
-  Serial.print("Nome da rede: ");
-  Serial.println(ap_ssid);
-  Serial.println("Rede ABERTA (sem senha)");
-  Serial.print("IP do servidor: ");
-  Serial.println(IP);
-  Serial.println("Conecte-se à rede e acesse: http://192.168.4.1");
+  if (SHARD_ID != 0) {
+    // Shards secundários entram na rede do shard 0 com IP fixo
+    Serial.printf("Shard %u: conectando a %s...\n", (unsigned)SHARD_ID, ap_ssid);
+    WiFi.mode(WIFI_STA);
+    WiFi.config(shardAddress(SHARD_ID), gateway, subnet);
+    WiFi.begin(ap_ssid);
+    unsigned long connectStart = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - connectStart < SHARD_CONNECT_TIMEOUT) {
+      delay(100);
+    }
+    if (WiFi.status() != WL_CONNECTED) {
+      // Sem o link o shard não serve a faixa dele: avisar e tentar de novo
+      Serial.printf("Shard %u: sem conexão com %s após %u ms (status %d), reiniciando\n",
+                    (unsigned)SHARD_ID, ap_ssid, (unsigned)SHARD_CONNECT_TIMEOUT, (int)WiFi.status());
+      delay(1000);
+      ESP.restart();
+    }
+    Serial.print("IP do shard: ");
+    Serial.println(WiFi.localIP());
+  } else {
+    // Configurar ESP32 como Access Point
+    Serial.println("Configurando Access Point...");
+    
+    WiFi.softAPConfig(local_ip, gateway, subnet);
+    WiFi.softAP(ap_ssid);
+    
+    IPAddress IP = WiFi.softAPIP();
+    Serial.println("Access Point iniciado!");
+    Serial.print("Nome da rede: ");
+    Serial.println(ap_ssid);
+    Serial.println("Rede ABERTA (sem senha)");
+    Serial.print("IP do servidor: ");
+    Serial.println(IP);
+    Serial.println("Conecte-se à rede e acesse: http://192.168.4.1");
+  }
+
+#if SHARD_COUNT > 1
+  shardLink.begin(SHARD_PORT);
+#endif
 
   server.on("/", handleRoot);
+  server.on("/record", handleRecordDownload);
+  server.on("/record/start", handleRecordStart);
+  server.on("/record/stop", handleRecordStop);
   
   server.begin();
   Serial.println("Servidor HTTP iniciado!");
@@ -1155,10 +2120,20 @@ void setup() {
   webSocket.begin();
   webSocket.onEvent(webSocketEvent);
   Serial.println("Servidor WebSocket iniciado na porta 81!");
+
+#if RECORD_SESSION
+  startRecording();
+#endif
 }
 
 void loop() {
+  gameClock = millis() - worldEpoch;
   server.handleClient();
   webSocket.loop();
+#if SHARD_COUNT > 1
+  pollShardLink();
+#endif
+  gameTick();
   broadcastGameState();
+  printStats();
 }
\ No newline at end of file
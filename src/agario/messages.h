@@ -0,0 +1,57 @@
+#ifndef AGARIO_MESSAGES_H
+#define AGARIO_MESSAGES_H
+
+#include <string.h>
+#include <ArduinoJson.h>
+#include "world.h"
+
+// Mensagens de texto dos clientes: o tipo é resolvido uma vez a partir do
+// campo "type" (sem String), e o filtro do parser deixa passar só as
+// chaves que os handlers leem, então o resto nem ocupa a arena.
+
+// Mensagens recebidas maiores que isso são descartadas sem parse
+#define MAX_MESSAGE_SIZE 512
+
+enum MessageType {
+  MSG_UNKNOWN,
+  MSG_JOIN,
+  MSG_INPUT
+};
+
+inline MessageType parseMessageType(const char* type) {
+  if (!type) return MSG_UNKNOWN;
+  switch (type[0]) {
+    case 'j': return strcmp(type, "join") == 0 ? MSG_JOIN : MSG_UNKNOWN;
+    case 'i': return strcmp(type, "input") == 0 ? MSG_INPUT : MSG_UNKNOWN;
+  }
+  return MSG_UNKNOWN;
+}
+
+inline void buildInputFilter(JsonDocument& filter) {
+  filter["type"] = true;
+  filter["playerId"] = true;
+  filter["name"] = true;
+  filter["fillColor"] = true;
+  filter["strokeColor"] = true;
+  filter["seq"] = true;
+  filter["mx"] = true;
+  filter["my"] = true;
+  filter["dt"] = true;
+  filter["resume"] = true;
+}
+
+// Ocupar o slot de quem mandou join; a posição fica para quem chama
+inline int joinFromMessage(World& world, uint8_t num, JsonDocument& doc) {
+  return world.join(num, doc["playerId"] | "", doc["name"] | "",
+                    doc["fillColor"] | "", doc["strokeColor"] | "");
+}
+
+// O jogador é identificado pela conexão, não pelo id enviado
+inline void inputFromMessage(World& world, uint8_t num, JsonDocument& doc) {
+  int i = world.findClient(num);
+  if (i >= 0) {
+    world.applyInput(i, doc["seq"], doc["mx"], doc["my"], doc["dt"]);
+  }
+}
+
+#endif
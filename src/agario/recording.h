@@ -0,0 +1,159 @@
+#ifndef AGARIO_RECORDING_H
+#define AGARIO_RECORDING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Formato binário das gravações de sessão:
+//   cabeçalho: "AGR1" + semente do mundo (uint32 little-endian)
+//   evento:    delta de tempo em ms (varint) + tipo (1 byte)
+//              + cliente (1 byte) + tamanho (varint) + payload
+// O tempo é o relógio do jogo (gameMillis) e os ticks também são gravados,
+// então a reprodução pode rodar mais rápido que o tempo real e ainda
+// executar a simulação nos mesmos instantes da sessão original.
+
+#define RECORDING_MAGIC "AGR1"
+#define RECORDING_HEADER_SIZE 8
+#define RECORDING_MAX_PAYLOAD 512
+
+enum RecordedEventType {
+  REC_CONNECTED = 1,
+  REC_DISCONNECTED = 2,
+  REC_TEXT = 3,
+  REC_PONG = 4,     // payload: RTT medido (uint16 little-endian)
+  REC_TICK = 5      // instante do gameTick; payload: decisões dos bots (uint8)
+};
+
+struct RecordedEvent {
+  uint32_t time;
+  uint8_t type;
+  uint8_t client;
+  uint16_t length;
+  const uint8_t* payload;
+};
+
+// Serializa eventos num buffer de tamanho fixo; quem usa esvazia o buffer
+// (grava no arquivo) quando remaining() não comporta o próximo evento.
+class RecordingWriter {
+ public:
+  RecordingWriter(uint8_t* buffer, size_t size)
+    : buffer_(buffer), size_(size), len_(0), lastTime_(0) {}
+
+  void writeHeader(uint32_t seed) {
+    memcpy(buffer_ + len_, RECORDING_MAGIC, 4);
+    for (int i = 0; i < 4; i++) buffer_[len_ + 4 + i] = (seed >> (8 * i)) & 0xFF;
+    len_ += RECORDING_HEADER_SIZE;
+    lastTime_ = 0;
+  }
+
+  static size_t maxEventSize(size_t payloadLength) {
+    return 5 + 2 + 3 + payloadLength;
+  }
+
+  bool append(uint32_t time, uint8_t type, uint8_t client,
+              const uint8_t* payload, uint16_t length) {
+    if (remaining() < maxEventSize(length)) return false;
+    putVarint(time - lastTime_);
+    buffer_[len_++] = type;
+    buffer_[len_++] = client;
+    putVarint(length);
+    if (length > 0) {
+      memcpy(buffer_ + len_, payload, length);
+      len_ += length;
+    }
+    lastTime_ = time;
+    return true;
+  }
+
+  const uint8_t* data() const { return buffer_; }
+  size_t length() const { return len_; }
+  size_t remaining() const { return size_ - len_; }
+  void clear() { len_ = 0; }
+
+ private:
+  void putVarint(uint32_t v) {
+    while (v >= 0x80) {
+      buffer_[len_++] = (uint8_t)(v | 0x80);
+      v >>= 7;
+    }
+    buffer_[len_++] = (uint8_t)v;
+  }
+
+  uint8_t* buffer_;
+  size_t size_;
+  size_t len_;
+  uint32_t lastTime_;
+};
+
+// Lê eventos em sequência a partir de uma fonte de bytes (ex.: arquivo no
+// SPIFFS), com um buffer pequeno; o payload do último evento fica em payload_
+class RecordingReader {
+ public:
+  typedef size_t (*Source)(void* ctx, uint8_t* buf, size_t n);
+
+  RecordingReader(Source source, void* ctx)
+    : source_(source), ctx_(ctx), pos_(0), len_(0), time_(0), seed_(0) {}
+
+  bool readHeader() {
+    uint8_t header[RECORDING_HEADER_SIZE];
+    for (int i = 0; i < RECORDING_HEADER_SIZE; i++) {
+      if (!getByte(header[i])) return false;
+    }
+    if (memcmp(header, RECORDING_MAGIC, 4) != 0) return false;
+    seed_ = 0;
+    for (int i = 0; i < 4; i++) seed_ |= (uint32_t)header[4 + i] << (8 * i);
+    time_ = 0;
+    return true;
+  }
+
+  bool next(RecordedEvent& event) {
+    uint32_t delta, length;
+    if (!getVarint(delta)) return false;
+    if (!getByte(event.type) || !getByte(event.client)) return false;
+    if (!getVarint(length) || length > RECORDING_MAX_PAYLOAD) return false;
+    for (uint32_t i = 0; i < length; i++) {
+      if (!getByte(payload_[i])) return false;
+    }
+    time_ += delta;
+    event.time = time_;
+    event.length = length;
+    event.payload = payload_;
+    return true;
+  }
+
+  uint32_t seed() const { return seed_; }
+
+ private:
+  bool getByte(uint8_t& b) {
+    if (pos_ == len_) {
+      len_ = source_(ctx_, buffer_, sizeof(buffer_));
+      pos_ = 0;
+      if (len_ == 0) return false;
+    }
+    b = buffer_[pos_++];
+    return true;
+  }
+
+  bool getVarint(uint32_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+      uint8_t b;
+      if (!getByte(b)) return false;
+      v |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) return true;
+    }
+    return false;
+  }
+
+  Source source_;
+  void* ctx_;
+  uint8_t buffer_[256];
+  size_t pos_;
+  size_t len_;
+  uint32_t time_;
+  uint32_t seed_;
+  uint8_t payload_[RECORDING_MAX_PAYLOAD];
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef AGARIO_REPLAY_H
+#define AGARIO_REPLAY_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "arena.h"
+#include "recording.h"
+#include "messages.h"
+#include "world.h"
+
+// Reprodução de uma sessão gravada (recording.h) sobre o World, no host.
+// Quem chama lê os eventos, avança o relógio do jogo para event.time e
+// passa cada um aqui, o mais rápido possível; REC_TICK roda o tick como
+// o gameTick do servidor. Nada sai pela rede.
+
+// true se o evento era um tick
+inline bool replayEvent(World& world, TickArena& arena, JsonDocument& filter,
+                        const RecordedEvent& event) {
+  switch (event.type) {
+    case REC_TICK:
+      // Nenhum documento sobrevive entre ticks. O payload é a contagem de
+      // decisões dos bots naquele tick; gravações antigas não têm
+      arena.reset();
+      world.tick(event.length == 1 ? event.payload[0] : BOT_THINKS_PER_TICK);
+      world.reapIdlePlayers();
+      return true;
+
+    case REC_DISCONNECTED:
+      {
+        int i = world.findClient(event.client);
+        if (i >= 0) world.removePlayer(i);
+      }
+      break;
+
+    case REC_PONG:
+      if (event.length == 2) {
+        int i = world.findClient(event.client);
+        if (i >= 0) world.pong(i, event.payload[0] | (event.payload[1] << 8));
+      }
+      break;
+
+    case REC_TEXT:
+      if (event.length <= MAX_MESSAGE_SIZE) {
+        ArenaScope scope(arena);
+        JsonDocument doc(&arena);
+        DeserializationError error = deserializeJson(doc, (const char*)event.payload, event.length,
+                                                     DeserializationOption::Filter(filter));
+        if (error) break;
+
+        switch (parseMessageType(doc["type"])) {
+          case MSG_JOIN:
+            {
+              // Sem snapshot na reprodução: todo join nasce numa posição nova
+              int i = joinFromMessage(world, event.client, doc);
+              if (i >= 0) world.spawnPlayer(i);
+            }
+            break;
+          case MSG_INPUT:
+            inputFromMessage(world, event.client, doc);
+            break;
+          default:
+            break;
+        }
+      }
+      break;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,482 @@
+#ifndef AGARIO_SHARD_H
+#define AGARIO_SHARD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "world.h"
+
+// Mundo dividido em faixas verticais, uma por nó: quem passa da borda é
+// entregue ao vizinho (handoff com ack e reenvio), e quem está perto dela
+// é espelhado lá (ghosts). Sem rede nem relógio próprios: o servidor liga
+// os avisos de ShardHooks ao WiFiUDP, o teste no host a sockets em
+// 127.0.0.1 ou a uma fila na memória.
+//
+// Limites dos espelhos:
+//   - colisão com um ghost é só um pedido: quem come manda SHARD_EAT ao
+//     dono da vítima, que confere com a posição atual dela e, se aceitar,
+//     responde com a massa ganha (SHARD_EAT_ACK). Quem é comido por um
+//     ghost é resolvido do outro lado, onde ele é o ghost.
+//   - pellets não são espelhados: uma célula sobre a borda só come (e o
+//     cliente só vê) os pellets da sua faixa, até o handoff a levar para a
+//     outra, HANDOFF_MARGIN depois da borda.
+//   - um ghost sem pacote novo em GHOST_TIMEOUT some; a posição dele pode
+//     estar até BROADCAST_MS (o intervalo dos pacotes) atrasada.
+
+#define GHOST_MARGIN 1000         // quem está a essa distância da borda é espelhado no vizinho
+#define GHOST_TIMEOUT 500         // sem pacote do vizinho, o espelho deixa de existir
+#define HANDOFF_MARGIN 50         // passar da borda por essa folga inicia o handoff
+#define HANDOFF_RETRY_MS 200
+#define HANDOFF_TIMEOUT 2000      // sem ack, o jogador volta para dentro da faixa
+#define RECENT_HANDOFFS 8         // handoffs aceitos lembrados contra reenvios
+
+// Mensagens entre shards (mesma CPU dos dois lados: structs como estão;
+// ShardPlayerState está em world.h)
+enum ShardMessageType {
+  SHARD_GHOSTS = 1,
+  SHARD_HANDOFF = 2,
+  SHARD_HANDOFF_ACK = 3,
+  SHARD_EAT = 4,
+  SHARD_EAT_ACK = 5
+};
+
+struct ShardGhostsHeader {
+  uint8_t type;
+  uint8_t fromShard;
+  uint8_t count;          // seguido de 'count' ShardPlayerState
+  uint8_t reserved;
+};
+
+struct ShardHandoff {
+  uint8_t type;
+  uint8_t fromShard;
+  uint16_t handoffId;
+  uint8_t isBot;
+  uint32_t resumeToken;
+  ShardPlayerState state;
+};
+
+struct ShardAck {
+  uint8_t type;
+  uint8_t fromShard;
+  uint16_t handoffId;
+};
+
+// Pedido de quem comeu um ghost; a vítima é procurada pelo id
+struct ShardEat {
+  uint8_t type;
+  uint8_t fromShard;
+  char eaterId[PLAYER_ID_SIZE];
+  char eaterName[PLAYER_NAME_SIZE];
+  char victimId[PLAYER_ID_SIZE];
+  float x;                // posição e raio de quem come, no pedido
+  float y;
+  float r;
+};
+
+struct ShardEatAck {
+  uint8_t type;
+  uint8_t fromShard;
+  char eaterId[PLAYER_ID_SIZE];
+  float gained;           // raio somado a quem comeu
+};
+
+#define SHARD_MAX_PACKET (sizeof(ShardGhostsHeader) + MAX_PLAYERS * sizeof(ShardPlayerState))
+
+// Contadores entre dois relatórios. Os de tick e de resume são somados
+// pelo servidor (gameTick, claimResume).
+struct ShardStats {
+  uint32_t ticks;
+  uint32_t tickMicros;
+  uint32_t maxTickMicros;
+  uint32_t handoffs;
+  uint32_t ackMillis;
+  uint32_t maxAckMillis;
+  uint32_t failed;
+  uint32_t received;
+  uint32_t resumes;
+  uint32_t resumeMillis;
+  uint32_t ghostEats;     // ghosts comidos aqui (confirmados pelo dono)
+  uint32_t eatenRemote;   // jogadores daqui comidos por um ghost deles lá
+};
+
+// send e millis são obrigatórios; os outros podem ficar nulos
+struct ShardHooks {
+  void (*send)(int shard, const uint8_t* data, size_t len);
+  unsigned long (*millis)();            // relógio de parede: prazos, reenvios, ghosts
+  // Ack do handoff do jogador i para o shard 'to', antes de liberar o
+  // slot: no servidor, o humano recebe o endereço para reconectar
+  void (*handedOff)(int i, int to);
+  // Humano chegando por handoff: guardar até ele reconectar com o token;
+  // false se não há espaço (sem ack, a origem desiste sozinha)
+  bool (*humanArrived)(const ShardHandoff& msg);
+};
+
+class ShardNode {
+ public:
+  ShardNode(World& world, int id, int count)
+    : id_(id), count_(count), width_((float)WORLD_SIZE / count),
+      world_(world), nextHandoffId_(0), recentHead_(0) {
+    memset(&hooks, 0, sizeof(hooks));
+    memset(&stats, 0, sizeof(stats));
+    memset(recent_, 0, sizeof(recent_));
+  }
+
+  int id() const { return id_; }
+  int count() const { return count_; }
+
+  int shardOf(float x) const {
+    int s = (int)(x / width_);
+    return s < 0 ? 0 : (s > count_ - 1 ? count_ - 1 : s);
+  }
+
+  float minX() const { return id_ * width_; }
+  float maxX() const { return (id_ + 1) * width_; }
+
+  // Faixa e id dos bots no mundo; chamar antes de World::reset()
+  void begin() {
+    world_.minX = minX();
+    world_.maxX = maxX();
+    world_.shard = id_;
+  }
+
+  // A cada tick do servidor: handoffs pendentes e colisões com os ghosts
+  void tick() {
+    checkHandoffs();
+    resolveGhosts();
+  }
+
+  // A cada snapshot do servidor: espelhos para os dois vizinhos
+  void broadcast() {
+    sendGhosts(id_ - 1);
+    sendGhosts(id_ + 1);
+  }
+
+  // Espelho sem notícia do vizinho há GHOST_TIMEOUT deixa de ser desenhado
+  void expireGhosts() {
+    for (int g = 0; g < MAX_GHOSTS; g++) {
+      if (world_.ghosts[g].active && hooks.millis() - world_.ghosts[g].lastSeen >= GHOST_TIMEOUT) {
+        world_.ghosts[g].active = false;
+      }
+    }
+  }
+
+  // Um datagrama do link
+  void receive(const uint8_t* packet, size_t len) {
+    if (len < sizeof(ShardAck) || packet[1] >= count_) {
+      return;
+    }
+    switch (packet[0]) {
+      case SHARD_GHOSTS:
+        handleGhosts(packet, len);
+        break;
+      case SHARD_HANDOFF:
+        if (len == sizeof(ShardHandoff)) {
+          ShardHandoff msg;
+          memcpy(&msg, packet, sizeof(msg));
+          handleHandoff(msg);
+        }
+        break;
+      case SHARD_HANDOFF_ACK:
+        {
+          ShardAck ack;
+          memcpy(&ack, packet, sizeof(ack));
+          handleHandoffAck(ack);
+        }
+        break;
+      case SHARD_EAT:
+        if (len == sizeof(ShardEat)) {
+          ShardEat msg;
+          memcpy(&msg, packet, sizeof(msg));
+          handleEat(msg);
+        }
+        break;
+      case SHARD_EAT_ACK:
+        if (len == sizeof(ShardEatAck)) {
+          ShardEatAck ack;
+          memcpy(&ack, packet, sizeof(ack));
+          handleEatAck(ack);
+        }
+        break;
+    }
+  }
+
+  ShardHooks hooks;
+  ShardStats stats;
+
+ private:
+  static float clampf(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+  }
+
+  static void terminate(char* text, size_t size) {
+    text[size - 1] = '\0';
+  }
+
+  void fillState(ShardPlayerState& state, int i) const {
+    const Player& player = world_.players[i];
+    memcpy(state.id, player.id, PLAYER_ID_SIZE);
+    memcpy(state.name, player.name, PLAYER_NAME_SIZE);
+    memcpy(state.fillColor, player.fillColor, PLAYER_COLOR_SIZE);
+    memcpy(state.strokeColor, player.strokeColor, PLAYER_COLOR_SIZE);
+    state.x = player.x;
+    state.y = player.y;
+    state.r = player.r;
+  }
+
+  int findPlayer(const char* id) const {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (world_.players[i].active && strcmp(world_.players[i].id, id) == 0) return i;
+    }
+    return -1;
+  }
+
+  // Espelhar no vizinho quem está perto da borda com ele (ou já passou dela)
+  void sendGhosts(int neighbour) {
+    if (neighbour < 0 || neighbour >= count_) {
+      return;
+    }
+    ShardGhostsHeader header = { SHARD_GHOSTS, (uint8_t)id_, 0, 0 };
+    size_t pos = sizeof(header);
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (!world_.players[i].active) continue;
+      float toBorder = (neighbour < id_) ? world_.players[i].x - minX() : maxX() - world_.players[i].x;
+      if (toBorder < GHOST_MARGIN) {
+        ShardPlayerState state;
+        fillState(state, i);
+        memcpy(packet_ + pos, &state, sizeof(state));
+        pos += sizeof(state);
+        header.count++;
+      }
+    }
+    memcpy(packet_, &header, sizeof(header));
+    hooks.send(neighbour, packet_, pos);
+  }
+
+  void sendHandoff(int i) {
+    ShardHandoff msg;
+    msg.type = SHARD_HANDOFF;
+    msg.fromShard = id_;
+    msg.handoffId = world_.players[i].handoffId;
+    msg.isBot = world_.players[i].isBot;
+    msg.resumeToken = world_.players[i].resumeToken;
+    fillState(msg.state, i);
+    hooks.send(shardOf(world_.players[i].x), (const uint8_t*)&msg, sizeof(msg));
+    world_.players[i].handoffLastSend = hooks.millis();
+  }
+
+  // Quem passou da borda (com folga) é entregue ao shard vizinho. O jogador
+  // continua aqui até o ack; sem ack no prazo, volta para dentro da faixa.
+  void checkHandoffs() {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      Player& player = world_.players[i];
+      if (!player.active) continue;
+
+      if (player.handoffId != 0) {
+        if (hooks.millis() - player.handoffStart > HANDOFF_TIMEOUT) {
+          player.x = clampf(player.x, minX() + player.r, maxX() - player.r);
+          player.handoffId = 0;
+          stats.failed++;
+        } else if (hooks.millis() - player.handoffLastSend >= HANDOFF_RETRY_MS) {
+          sendHandoff(i);
+        }
+        continue;
+      }
+
+      if (player.x < minX() - HANDOFF_MARGIN || player.x > maxX() + HANDOFF_MARGIN) {
+        if (++nextHandoffId_ == 0) nextHandoffId_ = 1;
+        player.handoffId = nextHandoffId_;
+        player.handoffStart = hooks.millis();
+        sendHandoff(i);
+      }
+    }
+  }
+
+  // O vizinho aceitou: o slot é liberado (humanos antes recebem o aviso)
+  void handleHandoffAck(const ShardAck& ack) {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (!world_.players[i].active || world_.players[i].handoffId != ack.handoffId) continue;
+
+      uint32_t elapsed = hooks.millis() - world_.players[i].handoffStart;
+      stats.handoffs++;
+      stats.ackMillis += elapsed;
+      if (elapsed > stats.maxAckMillis) stats.maxAckMillis = elapsed;
+
+      if (!world_.players[i].isBot && hooks.handedOff) {
+        hooks.handedOff(i, ack.fromShard);
+      }
+      world_.removePlayer(i);
+      break;
+    }
+  }
+
+  // Bot recebido do vizinho entra direto no primeiro slot livre
+  bool adoptBot(const ShardPlayerState& state) {
+    int i = -1;
+    for (int k = 0; k < MAX_PLAYERS && i < 0; k++) {
+      if (!world_.players[k].active) i = k;
+    }
+    if (i < 0) return false;
+
+    Player& player = world_.players[i];
+    memcpy(player.id, state.id, PLAYER_ID_SIZE);
+    memcpy(player.name, state.name, PLAYER_NAME_SIZE);
+    memcpy(player.fillColor, state.fillColor, PLAYER_COLOR_SIZE);
+    memcpy(player.strokeColor, state.strokeColor, PLAYER_COLOR_SIZE);
+    terminate(player.id, PLAYER_ID_SIZE);
+    terminate(player.name, PLAYER_NAME_SIZE);
+    terminate(player.fillColor, PLAYER_COLOR_SIZE);
+    terminate(player.strokeColor, PLAYER_COLOR_SIZE);
+    player.x = state.x;
+    player.y = state.y;
+    player.r = state.r > CELL_MIN_RADIUS ? state.r : CELL_MIN_RADIUS;
+    world_.leaderboard.update(i, player.r);
+    player.spawnTick = world_.tickCount;
+    player.handoffId = 0;
+    player.clientNum = BOT_CLIENT_NUM;
+    player.active = true;
+    player.isBot = true;
+    player.mx = 0;
+    player.my = 0;
+    player.nextThink = 0;
+    player.lastUpdate = world_.now();
+    player.lastInputSeq = 0;
+    player.rttMs = 0;
+    world_.playerCount++;
+    return true;
+  }
+
+  // Receber um jogador do vizinho: bots entram direto, humanos ficam com
+  // quem chama até reconectarem. Sem espaço não há ack.
+  void handleHandoff(const ShardHandoff& msg) {
+    uint32_t key = ((uint32_t)msg.fromShard << 16) | msg.handoffId;
+    bool seen = false;
+    for (int k = 0; k < RECENT_HANDOFFS; k++) {
+      if (recent_[k] == key) seen = true;
+    }
+
+    if (!seen) {
+      bool accepted = msg.isBot ? adoptBot(msg.state)
+                                : (hooks.humanArrived && hooks.humanArrived(msg));
+      if (!accepted) return;
+
+      recent_[recentHead_] = key;
+      recentHead_ = (recentHead_ + 1) % RECENT_HANDOFFS;
+      stats.received++;
+    }
+
+    // Reenvio de um handoff já aceito: o ack anterior se perdeu
+    ShardAck ack = { SHARD_HANDOFF_ACK, (uint8_t)id_, msg.handoffId };
+    hooks.send(msg.fromShard, (const uint8_t*)&ack, sizeof(ack));
+  }
+
+  void handleGhosts(const uint8_t* data, size_t len) {
+    ShardGhostsHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (len != sizeof(header) + header.count * sizeof(ShardPlayerState)) {
+      return;
+    }
+
+    // O pacote traz todos os espelhos daquele shard: os antigos saem
+    for (int g = 0; g < MAX_GHOSTS; g++) {
+      if (world_.ghosts[g].shard == header.fromShard) world_.ghosts[g].active = false;
+    }
+    size_t pos = sizeof(header);
+    for (int g = 0; g < MAX_GHOSTS && header.count > 0; g++) {
+      Ghost& ghost = world_.ghosts[g];
+      if (ghost.active) continue;
+      memcpy(&ghost.state, data + pos, sizeof(ShardPlayerState));
+      terminate(ghost.state.id, PLAYER_ID_SIZE);
+      terminate(ghost.state.name, PLAYER_NAME_SIZE);
+      terminate(ghost.state.fillColor, PLAYER_COLOR_SIZE);
+      terminate(ghost.state.strokeColor, PLAYER_COLOR_SIZE);
+      ghost.shard = header.fromShard;
+      ghost.lastSeen = hooks.millis();
+      ghost.active = true;
+      pos += sizeof(ShardPlayerState);
+      header.count--;
+    }
+  }
+
+  // Jogadores daqui sobre ghosts menores: pedir a vítima ao dono dela. O
+  // ghost sai até o próximo pacote, para não repetir o pedido a cada tick.
+  void resolveGhosts() {
+    for (int g = 0; g < MAX_GHOSTS; g++) {
+      Ghost& ghost = world_.ghosts[g];
+      if (!ghost.active) continue;
+
+      for (int i = 0; i < MAX_PLAYERS; i++) {
+        const Player& player = world_.players[i];
+        if (!player.active || player.handoffId != 0) continue;
+
+        float dx = player.x - ghost.state.x;
+        float dy = player.y - ghost.state.y;
+        if (player.r > ghost.state.r * 1.1 && sqrtf(dx*dx + dy*dy) < player.r) {
+          ShardEat msg;
+          memset(&msg, 0, sizeof(msg));
+          msg.type = SHARD_EAT;
+          msg.fromShard = id_;
+          memcpy(msg.eaterId, player.id, PLAYER_ID_SIZE);
+          memcpy(msg.eaterName, player.name, PLAYER_NAME_SIZE);
+          memcpy(msg.victimId, ghost.state.id, PLAYER_ID_SIZE);
+          msg.x = player.x;
+          msg.y = player.y;
+          msg.r = player.r;
+          hooks.send(ghost.shard, (const uint8_t*)&msg, sizeof(msg));
+          ghost.active = false;
+          break;
+        }
+      }
+    }
+  }
+
+  // Dono da vítima: vale a posição atual dela, não a do espelho. Quem
+  // está no meio de um handoff já foi entregue e não é comido aqui.
+  void handleEat(ShardEat& msg) {
+    terminate(msg.eaterId, PLAYER_ID_SIZE);
+    terminate(msg.eaterName, PLAYER_NAME_SIZE);
+    terminate(msg.victimId, PLAYER_ID_SIZE);
+
+    int j = findPlayer(msg.victimId);
+    if (j < 0 || world_.players[j].handoffId != 0) return;
+
+    float dx = msg.x - world_.players[j].x;
+    float dy = msg.y - world_.players[j].y;
+    if (!(msg.r > world_.players[j].r * 1.1 && sqrtf(dx*dx + dy*dy) < msg.r)) return;
+
+    ShardEatAck ack;
+    memset(&ack, 0, sizeof(ack));
+    ack.type = SHARD_EAT_ACK;
+    ack.fromShard = id_;
+    memcpy(ack.eaterId, msg.eaterId, PLAYER_ID_SIZE);
+    ack.gained = world_.players[j].r * 0.8f;
+
+    world_.eatenBy(j, msg.eaterId, msg.eaterName);
+    stats.eatenRemote++;
+    hooks.send(msg.fromShard, (const uint8_t*)&ack, sizeof(ack));
+  }
+
+  // Confirmado: quem comeu cresce (se ainda está aqui)
+  void handleEatAck(ShardEatAck& ack) {
+    terminate(ack.eaterId, PLAYER_ID_SIZE);
+    int i = findPlayer(ack.eaterId);
+    if (i < 0) return;
+
+    world_.players[i].r += ack.gained;
+    world_.leaderboard.update(i, world_.players[i].r);
+    stats.ghostEats++;
+  }
+
+  const int id_;
+  const int count_;
+  const float width_;
+  World& world_;
+  uint16_t nextHandoffId_;
+  uint32_t recent_[RECENT_HANDOFFS];   // (shard << 16 | id) já aceitos
+  uint8_t recentHead_;
+  uint8_t packet_[SHARD_MAX_PACKET];
+};
+
+#endif
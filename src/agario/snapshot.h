@@ -0,0 +1,52 @@
+#ifndef AGARIO_SNAPSHOT_H
+#define AGARIO_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Formato binário do snapshot do mundo (mesma CPU que grava e lê, então
+// as structs vão como estão na memória):
+//   SnapshotHeader | SnapshotPellet[pelletCount] | SnapshotPlayer[playerCount] | CRC32
+// O CRC cobre tudo antes dele; arquivo truncado ou corrompido é ignorado.
+
+#define SNAPSHOT_MAGIC 0x31534741   // "AGS1"
+
+struct SnapshotHeader {
+  uint32_t magic;
+  uint32_t seq;          // o maior seq válido entre os dois arquivos vence
+  uint32_t worldSeed;
+  uint32_t rngState;
+  uint32_t length;       // bytes do arquivo inteiro, com o CRC
+  uint16_t pelletCount;
+  uint16_t playerCount;
+};
+
+struct SnapshotPellet {
+  int16_t x;
+  int16_t y;
+  uint8_t r;
+  uint8_t color;
+};
+
+// Só o necessário para o jogador reassumir a célula com o token
+struct SnapshotPlayer {
+  uint32_t resumeToken;
+  float x;
+  float y;
+  float r;
+};
+
+// CRC-32 (polinômio refletido 0xEDB88320) calculado aos pedaços:
+// crc = crc32Update(0, a, n); crc = crc32Update(crc, b, m); ...
+inline uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+#endif
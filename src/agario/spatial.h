@@ -0,0 +1,147 @@
+#ifndef AGARIO_SPATIAL_H
+#define AGARIO_SPATIAL_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Grade uniforme sobre o mundo para consultas de vizinhança. Cada célula
+// da grade guarda uma lista encadeada de ids (índices em pellets[] ou
+// players[]); a memória é fixa: um int16 por célula e quatro por item.
+//
+// nearest() percorre anéis de células a partir do ponto e para assim que
+// o anel seguinte não pode ter nada mais perto que o k-ésimo encontrado.
+
+#define GRID_CELL_SIZE 250
+#define GRID_DIM 20               // WORLD_SIZE / GRID_CELL_SIZE
+#define GRID_MAX_K 8
+
+template <int MaxItems>
+class SpatialGrid {
+ public:
+  typedef bool (*Filter)(int id, void* ctx);
+
+  SpatialGrid() { clear(); }
+
+  void clear() {
+    for (int c = 0; c < GRID_DIM * GRID_DIM; c++) head_[c] = -1;
+    for (int i = 0; i < MaxItems; i++) cell_[i] = -1;
+  }
+
+  void insert(int id, float x, float y) {
+    int c = cellOf(x, y);
+    x_[id] = (int16_t)x;
+    y_[id] = (int16_t)y;
+    cell_[id] = c;
+    next_[id] = head_[c];
+    head_[c] = id;
+  }
+
+  void remove(int id) {
+    int c = cell_[id];
+    if (c < 0) return;
+    int16_t* link = &head_[c];
+    while (*link != -1) {
+      if (*link == id) {
+        *link = next_[id];
+        break;
+      }
+      link = &next_[*link];
+    }
+    cell_[id] = -1;
+  }
+
+  void move(int id, float x, float y) {
+    if (cell_[id] == cellOf(x, y)) {
+      x_[id] = (int16_t)x;
+      y_[id] = (int16_t)y;
+      return;
+    }
+    remove(id);
+    insert(id, x, y);
+  }
+
+  // Até k ids mais próximos de (x, y) dentro de maxDist, do mais perto ao
+  // mais longe. 'accept' permite ignorar itens (ex.: o próprio jogador).
+  int nearest(float x, float y, int k, int* out, float maxDist,
+              Filter accept = 0, void* ctx = 0) const {
+    if (k > GRID_MAX_K) k = GRID_MAX_K;
+    float bestDist[GRID_MAX_K];
+    int found = 0;
+
+    int cx = clampCell(x);
+    int cy = clampCell(y);
+    int maxRing = (int)(maxDist / GRID_CELL_SIZE) + 1;
+
+    for (int ring = 0; ring <= maxRing && ring < GRID_DIM; ring++) {
+      // Tudo no anel 'ring' está a pelo menos (ring - 1) células de distância
+      float ringMin = (ring - 1) * (float)GRID_CELL_SIZE;
+      if (found == k && ringMin > bestDist[found - 1]) break;
+      if (ringMin > maxDist) break;
+
+      for (int gy = cy - ring; gy <= cy + ring; gy++) {
+        if (gy < 0 || gy >= GRID_DIM) continue;
+        bool edgeRow = (gy == cy - ring || gy == cy + ring);
+        int step = edgeRow ? 1 : 2 * ring;
+        for (int gx = cx - ring; gx <= cx + ring; gx += (step > 0 ? step : 1)) {
+          if (gx < 0 || gx >= GRID_DIM) continue;
+          for (int id = head_[gy * GRID_DIM + gx]; id != -1; id = next_[id]) {
+            if (accept && !accept(id, ctx)) continue;
+            float dx = x_[id] - x;
+            float dy = y_[id] - y;
+            float d = sqrtf(dx * dx + dy * dy);
+            if (d > maxDist) continue;
+            if (found == k && d >= bestDist[found - 1]) continue;
+
+            // Inserção ordenada no resultado (k é pequeno)
+            int pos = (found < k) ? found++ : found - 1;
+            while (pos > 0 && bestDist[pos - 1] > d) {
+              bestDist[pos] = bestDist[pos - 1];
+              out[pos] = out[pos - 1];
+              pos--;
+            }
+            bestDist[pos] = d;
+            out[pos] = id;
+          }
+        }
+      }
+    }
+    return found;
+  }
+
+  // Ids cujo ponto está a até 'radius' de (x, y)
+  int within(float x, float y, float radius, int* out, int maxOut) const {
+    int found = 0;
+    int x0 = clampCell(x - radius), x1 = clampCell(x + radius);
+    int y0 = clampCell(y - radius), y1 = clampCell(y + radius);
+    for (int gy = y0; gy <= y1; gy++) {
+      for (int gx = x0; gx <= x1; gx++) {
+        for (int id = head_[gy * GRID_DIM + gx]; id != -1; id = next_[id]) {
+          float dx = x_[id] - x;
+          float dy = y_[id] - y;
+          if (dx * dx + dy * dy < radius * radius && found < maxOut) {
+            out[found++] = id;
+          }
+        }
+      }
+    }
+    return found;
+  }
+
+ private:
+  static int clampCell(float v) {
+    int c = (int)(v / GRID_CELL_SIZE);
+    return c < 0 ? 0 : (c >= GRID_DIM ? GRID_DIM - 1 : c);
+  }
+
+  static int cellOf(float x, float y) {
+    return clampCell(y) * GRID_DIM + clampCell(x);
+  }
+
+  int16_t head_[GRID_DIM * GRID_DIM];
+  int16_t next_[MaxItems];
+  int16_t cell_[MaxItems];
+  int16_t x_[MaxItems];
+  int16_t y_[MaxItems];
+};
+
+#endif
@@ -0,0 +1,604 @@
+#ifndef AGARIO_WORLD_H
+#define AGARIO_WORLD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "spatial.h"
+#include "leaderboard.h"
+
+// Simulação do agario sem rede, arquivo nem JSON: jogadores, pellets,
+// histórico da compensação de latência, colisões, bots e perda de massa.
+// O servidor (main.cpp) liga a rede em volta; o replayer e as bancadas no
+// host usam a mesma classe. Tudo que precisa sair para os clientes passa
+// pelos avisos de WorldHooks.
+
+// Parâmetros da simulação (iguais aos do cliente). No host dá para subir
+// o número de slots com -D MAX_PLAYERS=... (bancada de bots); no ESP32 são 10.
+#ifndef MAX_PLAYERS
+#define MAX_PLAYERS 10
+#endif
+#define MAX_PELLETS 1000
+#define WORLD_SIZE 5000
+#define CELL_BASE_SPEED 250
+#define CELL_LINE_WIDTH 5
+#define CELL_MIN_RADIUS 15
+#define MAX_INPUT_DT 0.25f
+#define TICK_MS 50
+#define DECAY_INTERVAL 5000
+
+// Compensação de latência
+#define HISTORY_TICKS 32      // 1,6 s de histórico a 20 ticks/s
+#define PLAYER_TIMEOUT 5000   // sem input nem pong por esse tempo, o slot é liberado
+#define INTERP_DELAY_MS 200   // igual a interpolation_delay no cliente
+
+// Bots: completam a população quando há poucos humanos
+#define BOT_POPULATION 6      // bots entram até haver esse total de jogadores
+#define BOT_CLIENT_NUM 0xFF   // clientNum dos bots (nenhuma conexão usa)
+#define BOT_THINK_MS 200      // cada bot decide no máximo a cada intervalo
+#define BOT_BUDGET_US 1500    // ao vivo: tempo máximo de decisão dos bots por tick
+#define BOT_THINKS_PER_TICK 2 // reprodução de gravações antigas, sem a contagem no tick
+#define BOT_SIGHT 800         // raio das consultas de vizinhança dos bots
+#define BOT_NEIGHBOURS 4
+
+// Jogadores de outros shards espelhados aqui (ver shard.h)
+#define MAX_GHOSTS (2 * MAX_PLAYERS)
+
+// Ranking por raio
+#define LEADERBOARD_SIZE 5
+
+// Campos de texto do jogador em buffers fixos
+#define PLAYER_ID_SIZE 16
+#define PLAYER_NAME_SIZE 24
+#define PLAYER_COLOR_SIZE 24
+
+struct Player {
+  char id[PLAYER_ID_SIZE];
+  char name[PLAYER_NAME_SIZE];
+  float x;
+  float y;
+  float r;
+  float mx;
+  float my;
+  char fillColor[PLAYER_COLOR_SIZE];
+  char strokeColor[PLAYER_COLOR_SIZE];
+  uint8_t clientNum;
+  unsigned long lastUpdate;
+  uint32_t lastInputSeq;
+  uint32_t spawnTick;
+  uint16_t rttMs;
+  uint32_t resumeToken;     // devolvido no init; reassume a célula após um reinício
+  uint16_t handoffId;       // != 0: aguardando ack do shard vizinho
+  unsigned long handoffStart;
+  unsigned long handoffLastSend;
+  bool active;
+  bool isBot;
+  unsigned long nextThink;  // bots: próxima decisão
+};
+
+struct Pellet {
+  float x;
+  float y;
+  float r;
+  uint8_t color;     // índice em pelletColors
+};
+
+// Mesma paleta do cliente (colors)
+static const char* const pelletColors[] = {
+  "rgb(255,130,7)", "rgb(255,7,139)", "rgb(254,255,0)",
+  "rgb(7,255,171)", "rgb(255,14,7)", "rgb(81,255,7)",
+  "rgb(7,191,255)", "rgb(7,133,255)", "rgb(205,7,255)"
+};
+#define PELLET_COLOR_COUNT (sizeof(pelletColors) / sizeof(pelletColors[0]))
+
+struct PositionSample {
+  float x;
+  float y;
+  float r;
+};
+
+// O que um vizinho sabe de um jogador (é também o formato no link)
+struct ShardPlayerState {
+  char id[PLAYER_ID_SIZE];
+  char name[PLAYER_NAME_SIZE];
+  char fillColor[PLAYER_COLOR_SIZE];
+  char strokeColor[PLAYER_COLOR_SIZE];
+  float x;
+  float y;
+  float r;
+};
+
+struct Ghost {
+  ShardPlayerState state;
+  uint8_t shard;
+  unsigned long lastSeen;
+  bool active;
+};
+
+struct BotStats {
+  uint32_t ticks;
+  uint32_t decisions;
+  uint32_t micros;
+  uint32_t maxMicros;
+};
+
+// clock é obrigatório; os avisos podem ficar nulos
+struct WorldHooks {
+  unsigned long (*clock)();             // relógio do jogo em ms (gameMillis no servidor)
+  unsigned long (*micros)();            // relógio de parede: orçamento dos bots e estatísticas
+  void (*playerEaten)(int eaten, const char* eaterId, const char* eaterName);
+  void (*playerLeft)(int i);            // o slot acabou de ser liberado
+  void (*playerIdle)(int i);            // saiu por PLAYER_TIMEOUT (slot já liberado)
+};
+
+class World {
+ public:
+  World() : playerCount(0), historyHead(0), tickCount(0), seed(0), rngState(1),
+            minX(0), maxX(WORLD_SIZE), shard(0), botPopulation(BOT_POPULATION),
+            lastDecay(0), nextBot(0), botSerial(0) {
+    memset(&hooks, 0, sizeof(hooks));
+    memset(&botStats, 0, sizeof(botStats));
+    memset(players, 0, sizeof(players));
+    memset(ghosts, 0, sizeof(ghosts));
+  }
+
+  // Recomeçar a partir de uma semente: mesma semente, mesmos pellets,
+  // spawns e bots
+  void reset(uint32_t worldSeed) {
+    seed = worldSeed;
+    rngState = worldSeed ? worldSeed : 1;
+    lastDecay = 0;
+    nextBot = 0;
+    botSerial = 0;
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      players[i].active = false;
+    }
+    playerCount = 0;
+    playerGrid.clear();
+    leaderboard.clear();
+
+    pelletGrid.clear();
+    for (int i = 0; i < MAX_PELLETS; i++) {
+      pellets[i].x = random(minX + 10, maxX - 10);
+      pellets[i].y = random(10, 4990);
+      pellets[i].r = 1;
+      pellets[i].color = random(0, PELLET_COLOR_COUNT);
+      pelletGrid.insert(i, pellets[i].x, pellets[i].y);
+    }
+
+    memset(history, 0, sizeof(history));
+    historyHead = 0;
+    tickCount = 0;
+    memset(ghosts, 0, sizeof(ghosts));
+  }
+
+  // Inteiro em [minValue, maxValue), como random(); xorshift32
+  long random(long minValue, long maxValue) {
+    uint32_t x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return minValue + (long)(x % (uint32_t)(maxValue - minValue));
+  }
+
+  unsigned long now() const { return hooks.clock(); }
+
+  // Humano ativo da conexão num, ou -1
+  int findClient(uint8_t num) const {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (players[i].active && !players[i].isBot && players[i].clientNum == num) return i;
+    }
+    return -1;
+  }
+
+  // Ocupar um slot para um humano (um bot cede o lugar se estiver cheio).
+  // Outro join da mesma conexão reaproveita o slot dela em vez de ocupar
+  // mais um; se o id mudou, os clientes são avisados de que o antigo saiu.
+  // A posição fica para quem chama: spawnPlayer() ou a célula reassumida.
+  int join(uint8_t num, const char* id, const char* name,
+           const char* fillColor, const char* strokeColor) {
+    int i = findClient(num);
+    if (i >= 0) {
+      if (strcmp(players[i].id, id ? id : "") != 0 && hooks.playerLeft) hooks.playerLeft(i);
+    } else {
+      i = freeHumanSlot();
+      if (i < 0) return -1;
+      playerCount++;
+    }
+
+    copyText(players[i].id, id, PLAYER_ID_SIZE);
+    copyText(players[i].name, name, PLAYER_NAME_SIZE);
+    copyText(players[i].fillColor, fillColor, PLAYER_COLOR_SIZE);
+    copyText(players[i].strokeColor, strokeColor, PLAYER_COLOR_SIZE);
+    players[i].clientNum = num;
+    players[i].active = true;
+    players[i].isBot = false;
+    players[i].lastUpdate = now();
+    players[i].lastInputSeq = 0;
+    players[i].rttMs = 0;
+    players[i].handoffId = 0;
+    return i;
+  }
+
+  // Reposicionar um jogador (entrada ou depois de ser comido)
+  void spawnPlayer(int i) {
+    players[i].x = random(minX + 100, maxX - 100);
+    players[i].y = random(100, 4900);
+    players[i].r = CELL_MIN_RADIUS;
+    leaderboard.update(i, players[i].r);
+    players[i].spawnTick = tickCount;
+    players[i].handoffId = 0;
+  }
+
+  // Comido por quem o jogador j não tem aqui (outro shard; ver shard.h):
+  // mesmo aviso de eaten() e volta para um ponto da faixa
+  void eatenBy(int j, const char* eaterId, const char* eaterName) {
+    if (hooks.playerEaten) hooks.playerEaten(j, eaterId, eaterName);
+    spawnPlayer(j);
+  }
+
+  // Liberar o slot
+  void removePlayer(int i) {
+    players[i].active = false;
+    playerCount--;
+    leaderboard.remove(i);
+    if (hooks.playerLeft) hooks.playerLeft(i);
+  }
+
+  // Aplicar um input do cliente; o servidor é a fonte da verdade para x/y/r.
+  // A integração é a mesma de Cell.move() no cliente, para que a predição
+  // local só diverja quando houver colisão.
+  void applyInput(int i, uint32_t seq, float mx, float my, float dt) {
+    // Inputs repetidos ou fora de ordem são ignorados
+    if (seq <= players[i].lastInputSeq) {
+      return;
+    }
+    players[i].lastInputSeq = seq;
+
+    // Não confiar no cliente: direção unitária e dt limitado
+    float len = sqrtf(mx*mx + my*my);
+    if (len > 1) {
+      mx /= len;
+      my /= len;
+    }
+    dt = clampf(dt, 0.0f, MAX_INPUT_DT);
+
+    movePlayer(i, mx, my, dt);
+  }
+
+  void pong(int i, uint16_t rttMs) {
+    players[i].rttMs = rttMs;
+    players[i].lastUpdate = now();
+  }
+
+  PositionSample currentSample(int j) const {
+    PositionSample sample = { players[j].x, players[j].y, players[j].r };
+    return sample;
+  }
+
+  // Estado do jogador j como visto por quem tem o RTT informado: o cliente
+  // renderiza os outros INTERP_DELAY_MS atrás, mais meia viagem de rede.
+  // Nunca volta antes do último respawn de j. Custo O(1).
+  PositionSample rewindPlayer(int j, uint16_t rttMs) const {
+    uint32_t ticksBack = (rttMs / 2 + INTERP_DELAY_MS) / TICK_MS;
+    if (ticksBack > HISTORY_TICKS - 1) ticksBack = HISTORY_TICKS - 1;
+    if (ticksBack > tickCount - players[j].spawnTick) ticksBack = tickCount - players[j].spawnTick;
+
+    if (ticksBack == 0) {
+      return currentSample(j);
+    }
+    return history[(historyHead + HISTORY_TICKS - ticksBack) % HISTORY_TICKS][j];
+  }
+
+  // Integrar o movimento de um jogador e resolver as colisões
+  void movePlayer(int i, float mx, float my, float dt) {
+    float speed = CELL_BASE_SPEED * (20 / (players[i].r + CELL_LINE_WIDTH));
+    players[i].x = clampf(players[i].x + mx * speed * dt, players[i].r, WORLD_SIZE - players[i].r);
+    players[i].y = clampf(players[i].y + my * speed * dt, players[i].r, WORLD_SIZE - players[i].r);
+    players[i].lastUpdate = now();
+
+    resolveCollisions(i);
+  }
+
+  // Um tick da simulação: perda de massa, população e decisões dos bots,
+  // histórico. A rede (pings, inativos, handoffs) fica com quem chama.
+  // thinks < 0 (ao vivo): os bots decidem até gastar BOT_BUDGET_US; senão
+  // exatamente 'thinks' decisões, para a reprodução repetir o tick gravado.
+  // Devolve quantas decisões houve (o servidor grava no REC_TICK).
+  int tick(int thinks) {
+    tickCount++;
+
+    if (now() - lastDecay >= DECAY_INTERVAL) {
+      for (int i = 0; i < MAX_PLAYERS; i++) {
+        if (!players[i].active) continue;
+
+        float decreaseAmount = 1;
+        if (players[i].r > 1000) decreaseAmount = 5;
+        else if (players[i].r > 250) decreaseAmount = 3;
+
+        float r = players[i].r * ((100 - decreaseAmount) / 100);
+        players[i].r = r > CELL_MIN_RADIUS ? r : CELL_MIN_RADIUS;
+        leaderboard.update(i, players[i].r);
+      }
+      lastDecay = now();
+    }
+
+    manageBots();
+    int decisions = updateBots(thinks);
+    recordHistory();
+    return decisions;
+  }
+
+  // Humanos que travaram sem fechar o TCP não mandam input nem pong
+  void reapIdlePlayers() {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (players[i].active && !players[i].isBot && now() - players[i].lastUpdate > PLAYER_TIMEOUT) {
+        removePlayer(i);
+        if (hooks.playerIdle) hooks.playerIdle(i);
+      }
+    }
+  }
+
+  static void copyText(char* dst, const char* src, size_t size) {
+    snprintf(dst, size, "%s", src ? src : "");
+  }
+
+  Player players[MAX_PLAYERS];
+  int playerCount;
+  Pellet pellets[MAX_PELLETS];
+
+  // Ranking: atualizado a cada mudança de raio, enviado só quando a ordem muda
+  RankedList<MAX_PLAYERS, LEADERBOARD_SIZE> leaderboard;
+
+  // Índices espaciais: pellets são mantidos a cada mudança, jogadores
+  // são reconstruídos a cada tick
+  SpatialGrid<MAX_PELLETS> pelletGrid;
+  SpatialGrid<MAX_PLAYERS> playerGrid;
+
+  // Posições por tick (ring buffer de tamanho fixo)
+  PositionSample history[HISTORY_TICKS][MAX_PLAYERS];
+  uint8_t historyHead;
+  uint32_t tickCount;
+
+  Ghost ghosts[MAX_GHOSTS];
+
+  uint32_t seed;
+  uint32_t rngState;
+  float minX;          // faixa deste shard; pellets e spawns ficam nela
+  float maxX;
+  int shard;           // entra no id dos bots
+  int botPopulation;   // BOT_POPULATION; a bancada no host muda
+
+  WorldHooks hooks;
+  BotStats botStats;
+
+ private:
+  unsigned long lastDecay;
+  int nextBot;         // rodízio das decisões
+  uint16_t botSerial;
+
+  static float clampf(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+  }
+
+  static bool isOtherPlayer(int id, void* ctx) {
+    return id != *(int*)ctx;
+  }
+
+  void respawnPellet(int p) {
+    pellets[p].x = random(minX + 10, maxX - 10);
+    pellets[p].y = random(10, 4990);
+    pelletGrid.move(p, pellets[p].x, pellets[p].y);
+  }
+
+  void eaten(int j, int eater) {
+    eatenBy(j, players[eater].id, players[eater].name);
+  }
+
+  // Colisões do jogador i com pellets e outros jogadores
+  void resolveCollisions(int i) {
+    // Pellets: só os da vizinhança, pela grade
+    int eatenPellets[64];
+    int eatenCount = pelletGrid.within(players[i].x, players[i].y, players[i].r + 5, eatenPellets, 64);
+    for (int k = 0; k < eatenCount; k++) {
+      players[i].r += pellets[eatenPellets[k]].r;
+      respawnPellet(eatenPellets[k]);
+    }
+    if (eatenCount > 0) {
+      leaderboard.update(i, players[i].r);
+    }
+
+    for (int j = 0; j < MAX_PLAYERS; j++) {
+      if (i != j && players[j].active) {
+        // i ataca j na posição que i estava vendo na tela; bot não tem
+        // tela nem atraso de interpolação, vê j onde j está agora
+        PositionSample seen = players[i].isBot ? currentSample(j) : rewindPlayer(j, players[i].rttMs);
+        float dx = players[i].x - seen.x;
+        float dy = players[i].y - seen.y;
+        float seenDistance = sqrtf(dx*dx + dy*dy);
+
+        dx = players[i].x - players[j].x;
+        dy = players[i].y - players[j].y;
+        float distance = sqrtf(dx*dx + dy*dy);
+
+        // Se um jogador é 10% maior, pode comer o outro
+        if (players[i].r > seen.r * 1.1 && seenDistance < players[i].r) {
+          players[i].r += (players[j].r * 0.8);
+          leaderboard.update(i, players[i].r);
+          eaten(j, i);
+        } else if (players[j].r > players[i].r * 1.1 && distance < players[j].r) {
+          players[j].r += (players[i].r * 0.8);
+          leaderboard.update(j, players[j].r);
+          eaten(i, j);
+        }
+      }
+    }
+  }
+
+  // Colocar um bot num slot livre
+  void spawnBot(int i) {
+    uint16_t serial = ++botSerial;
+
+    snprintf(players[i].id, PLAYER_ID_SIZE, "bot%u.%u", (unsigned)shard, (unsigned)serial);
+    snprintf(players[i].name, PLAYER_NAME_SIZE, "Bot %u", (unsigned)serial);
+
+    // Contorno 15% mais escuro, como darkenColor() no cliente
+    int rgb[3] = {0, 0, 0};
+    const char* fill = pelletColors[random(0, PELLET_COLOR_COUNT)];
+    sscanf(fill, "rgb(%d,%d,%d)", &rgb[0], &rgb[1], &rgb[2]);
+    copyText(players[i].fillColor, fill, PLAYER_COLOR_SIZE);
+    snprintf(players[i].strokeColor, PLAYER_COLOR_SIZE, "rgb(%d,%d,%d)",
+             (int)(rgb[0] * 0.85f + 0.5f), (int)(rgb[1] * 0.85f + 0.5f), (int)(rgb[2] * 0.85f + 0.5f));
+
+    spawnPlayer(i);
+    players[i].clientNum = BOT_CLIENT_NUM;
+    players[i].active = true;
+    players[i].isBot = true;
+    players[i].mx = 0;
+    players[i].my = 0;
+    players[i].nextThink = 0;
+    players[i].lastUpdate = now();
+    players[i].lastInputSeq = 0;
+    players[i].rttMs = 0;
+    playerCount++;
+  }
+
+  // Manter a população em botPopulation: entra um bot por tick se faltar,
+  // sai um se sobrar
+  void manageBots() {
+    int bots = 0;
+    int lastBot = -1;
+    int freeSlot = -1;
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (!players[i].active) {
+        if (freeSlot < 0) freeSlot = i;
+      } else if (players[i].isBot) {
+        bots++;
+        lastBot = i;
+      }
+    }
+
+    if (playerCount < botPopulation && freeSlot >= 0) {
+      spawnBot(freeSlot);
+    } else if (playerCount > botPopulation && bots > 0) {
+      removePlayer(lastBot);
+    }
+  }
+
+  // Slot para um humano; se o servidor estiver cheio, um bot cede o lugar
+  int freeHumanSlot() {
+    int bot = -1;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (!players[i].active) return i;
+      if (players[i].isBot) bot = i;
+    }
+    if (bot >= 0) removePlayer(bot);
+    return bot;
+  }
+
+  // Decisão de um bot: fugir de quem pode comê-lo, caçar quem ele pode
+  // comer, senão ir ao pellet mais próximo. Só consultas k-NN na grade.
+  void botThink(int i) {
+    float x = players[i].x;
+    float y = players[i].y;
+    float fleeX = 0, fleeY = 0;
+    int prey = -1;
+
+    int near[BOT_NEIGHBOURS];
+    int n = playerGrid.nearest(x, y, BOT_NEIGHBOURS, near, BOT_SIGHT, isOtherPlayer, &i);
+    for (int k = 0; k < n; k++) {
+      int j = near[k];
+      float dx = players[j].x - x;
+      float dy = players[j].y - y;
+      float d = sqrtf(dx*dx + dy*dy);
+      if (d < 1.0f) d = 1.0f;
+
+      if (players[j].r > players[i].r * 1.1) {
+        // Peso maior para ameaças mais próximas
+        fleeX -= dx / (d * d);
+        fleeY -= dy / (d * d);
+      } else if (prey < 0 && players[i].r > players[j].r * 1.1) {
+        prey = j;
+      }
+    }
+
+    float tx, ty;
+    if (fleeX != 0 || fleeY != 0) {
+      tx = x + fleeX;
+      ty = y + fleeY;
+    } else if (prey >= 0) {
+      tx = players[prey].x;
+      ty = players[prey].y;
+    } else {
+      int pellet;
+      if (pelletGrid.nearest(x, y, 1, &pellet, WORLD_SIZE) == 0) return;
+      tx = pellets[pellet].x;
+      ty = pellets[pellet].y;
+    }
+
+    float dx = tx - x;
+    float dy = ty - y;
+    float len = sqrtf(dx*dx + dy*dy);
+    players[i].mx = len > 0 ? dx / len : 0;
+    players[i].my = len > 0 ? dy / len : 0;
+  }
+
+  // Bots decidem em rodízio dentro do orçamento de tempo (ou da contagem
+  // gravada, na reprodução); todos andam.
+  int updateBots(int thinks) {
+    unsigned long start = hooks.micros ? hooks.micros() : 0;
+
+    playerGrid.clear();
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (players[i].active) {
+        playerGrid.insert(i, players[i].x, players[i].y);
+      }
+    }
+
+    int decisions = 0;
+    for (int n = 0; n < MAX_PLAYERS; n++) {
+      if (thinks >= 0 ? decisions >= thinks
+                      : decisions == 255 || (hooks.micros && hooks.micros() - start >= BOT_BUDGET_US)) {
+        break;
+      }
+      int i = nextBot;
+      nextBot = (nextBot + 1) % MAX_PLAYERS;
+
+      if (players[i].active && players[i].isBot && (long)(now() - players[i].nextThink) >= 0) {
+        botThink(i);
+        players[i].nextThink = now() + BOT_THINK_MS;
+        decisions++;
+      }
+    }
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      if (players[i].active && players[i].isBot) {
+        movePlayer(i, players[i].mx, players[i].my, TICK_MS / 1000.0f);
+      }
+    }
+
+    uint32_t elapsed = hooks.micros ? (uint32_t)(hooks.micros() - start) : 0;
+    botStats.ticks++;
+    botStats.decisions += decisions;
+    botStats.micros += elapsed;
+    if (elapsed > botStats.maxMicros) botStats.maxMicros = elapsed;
+    return decisions;
+  }
+
+  // Gravar as posições do tick atual no histórico
+  void recordHistory() {
+    historyHead = (historyHead + 1) % HISTORY_TICKS;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+      history[historyHead][i].x = players[i].x;
+      history[historyHead][i].y = players[i].y;
+      history[historyHead][i].r = players[i].r;
+    }
+  }
+};
+
+#endif
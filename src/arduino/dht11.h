@@ -0,0 +1,128 @@
+#ifndef ARDUINO_DHT11_H
+#define ARDUINO_DHT11_H
+
+#include <Arduino.h>
+
+// Leitura do DHT11 sem travar o loop(): o pulso de início de 20 ms é
+// esperado com millis() e os 40 bits chegam por interrupção nas bordas de
+// descida. Cada bit é uma descida a ~76 us (0) ou ~120 us (1) da anterior.
+// O último valor bom fica guardado com a idade; falha (checksum ou bits
+// faltando) repete com espera dobrada, até DHT_ESPERA_MAX.
+
+#define DHT_INTERVALO 1000     // ms entre leituras (taxa máxima do DHT11)
+#define DHT_PULSO_INICIO 20    // ms em LOW para acordar o sensor (mín. 18)
+#define DHT_TIMEOUT 10         // ms para receber a resposta inteira
+#define DHT_ESPERA_MAX 16000   // ms entre tentativas depois de várias falhas
+#define DHT_LIMIAR_BIT 100     // us entre descidas: acima disso o bit é 1
+#define DHT_BORDAS 42          // resposta do sensor + início do 1º bit + 40 bits
+
+class Dht11 {
+ public:
+  explicit Dht11(uint8_t pino) : pino_(pino) {}
+
+  // borda: função do sketch que chama tratarBorda() (attachInterrupt não
+  // aceita método de objeto). A interrupção fica sempre ligada e ignora as
+  // bordas fora da recepção, inclusive a do próprio pulso de início.
+  void begin(void (*borda)()) {
+    pinMode(pino_, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(pino_), borda, FALLING);
+    proxima_ = millis() + DHT_INTERVALO;   // o sensor pede 1 s depois de ligar
+  }
+
+  // Chamar a cada volta do loop(); só muda de estado, nunca espera
+  void atualizar() {
+    unsigned long agora = millis();
+
+    switch (estado_) {
+      case OCIOSO:
+        if ((long)(agora - proxima_) >= 0) {
+          pinMode(pino_, OUTPUT);
+          digitalWrite(pino_, LOW);
+          inicio_ = agora;
+          estado_ = INICIO;
+        }
+        break;
+
+      case INICIO:
+        if (agora - inicio_ >= DHT_PULSO_INICIO) {
+          bordas_ = 0;
+          memset((void*)dados_, 0, sizeof(dados_));
+          recebendo_ = true;
+          pinMode(pino_, INPUT_PULLUP);
+          inicio_ = agora;
+          estado_ = RECEBENDO;
+        }
+        break;
+
+      case RECEBENDO:
+        if (bordas_ >= DHT_BORDAS || agora - inicio_ >= DHT_TIMEOUT) {
+          recebendo_ = false;
+          concluir(agora);
+          estado_ = OCIOSO;
+        }
+        break;
+    }
+  }
+
+  // Chamada pela interrupção de borda de descida
+  void tratarBorda() {
+    if (!recebendo_) return;
+    unsigned long agora = micros();
+    uint8_t n = bordas_;
+    if (n >= 2 && n < DHT_BORDAS) {
+      uint8_t bit = n - 2;
+      dados_[bit / 8] <<= 1;
+      if (agora - ultimaBorda_ > DHT_LIMIAR_BIT) dados_[bit / 8] |= 1;
+    }
+    ultimaBorda_ = agora;
+    bordas_ = n + 1;
+  }
+
+  boolean valido() const { return lidoEm_ != 0; }
+  int16_t umidade() const { return umidade_; }           // décimos de %
+  int16_t temperatura() const { return temperatura_; }   // décimos de grau
+  unsigned long idade() const { return millis() - lidoEm_; }   // ms desde a última leitura boa
+  unsigned int falhas() const { return falhas_; }               // seguidas, desde a última boa
+  unsigned long leituras() const { return leituras_; }          // boas, desde o início
+
+ private:
+  enum Estado { OCIOSO, INICIO, RECEBENDO };
+
+  void concluir(unsigned long agora) {
+    uint8_t soma = dados_[0] + dados_[1] + dados_[2] + dados_[3];
+    if (bordas_ >= DHT_BORDAS && soma == dados_[4]) {
+      umidade_ = dados_[0] * 10 + dados_[1];
+      temperatura_ = dados_[2] * 10 + (dados_[3] & 0x0F);
+      if (dados_[3] & 0x80) temperatura_ = -temperatura_;
+      lidoEm_ = agora ? agora : 1;
+      falhas_ = 0;
+      leituras_++;
+      proxima_ = agora + DHT_INTERVALO;
+      return;
+    }
+
+    falhas_++;
+    unsigned long espera = DHT_INTERVALO;
+    for (unsigned int k = 0; k < falhas_ && espera < DHT_ESPERA_MAX; k++) espera *= 2;
+    if (espera > DHT_ESPERA_MAX) espera = DHT_ESPERA_MAX;
+    proxima_ = agora + espera;
+  }
+
+  uint8_t pino_;
+  Estado estado_ = OCIOSO;
+  unsigned long inicio_ = 0;
+  unsigned long proxima_ = 0;
+
+  volatile boolean recebendo_ = false;
+  volatile uint8_t bordas_ = 0;
+  volatile uint8_t dados_[5];
+  volatile unsigned long ultimaBorda_ = 0;
+
+  int16_t umidade_ = 0;
+  int16_t temperatura_ = 0;
+  unsigned long lidoEm_ = 0;
+  unsigned int falhas_ = 0;
+  unsigned long leituras_ = 0;
+};
+
+#endif
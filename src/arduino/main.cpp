@@ -1,47 +1,71 @@
 #include "Arduino.h"
+#include <avr/sleep.h>
 #include <NewPing.h>
-#include <DHT.h>
-
-#define IDLE 0
-#define CLEAN 1
-#define DOCK 2
-#define CHRG 3
+#include "dht11.h"
+#include "protocolo.h"
+#include "roomba.h"
+#include "fsm.h"
+#include "agenda.h"
+#include "telemetria.h"
+#include "pino.h"
+#include "filtros.h"
+#include "console.h"
 
 #define LED1_PIN LED_BUILTIN_RX
 #define LED2_PIN LED_BUILTIN_TX
-#define DATAPATH1_PIN 6
-#define DATAPATH2_PIN 8
 
 #define HC_TRIGGER_PIN 7
 #define HC_ECHO_PIN 9
 #define HC_MAX_DISTANCE 400
 NewPing sonar(HC_TRIGGER_PIN, HC_ECHO_PIN, HC_MAX_DISTANCE);
 
-#define DHT_DATA 3
-#define DHTTYPE DHT11
-DHT dht(DHT_DATA, DHTTYPE);
+// Sonar por interrupção: a tarefa só dispara o ping e lê a fila
+#define SONAR_BLOQUEANTE 0      // 1: ping_cm() na tarefa, como antes (para comparar)
+#define PING_INTERVALO 50       // ms entre pings; o eco de 400 cm leva ~23 ms
+#define SONAR_FILA 8
 
-#define LDR_PIN A0
+#define DHT_DATA 3          // INT0 no Leonardo: os bits chegam por interrupção
+Dht11 dht(DHT_DATA);
 
-#define DIST_PIN0 15
-#define DIST_PIN1 14
-#define LUZ_PIN   16
-#define UMID_PIN  10
+#define LDR_PIN A0
 
-unsigned long timerEstado;
-unsigned long timerLED1;
-unsigned long timerLED2;
-unsigned long timerPrint;
+// Enlace com o ESP32 no Serial1 (pinos 0 e 1; o TX de 5 V passa por um
+// divisor antes do RX de 3,3 V do ESP32)
+#define ENVIO_INTERVALO 10      // ms entre quadros de sensores (100 Hz)
+#define ENLACE_TIMEOUT 500      // ms sem quadro de estado: volta para IDLE
 
-boolean estadoLED1 = false;
-boolean estadoLED2 = false;
+// Sem sombra: o core USB também acende e apaga os LEDs RX/TX com o
+// tráfego da serial, e o nível guardado deixaria de bater com o do pino.
+// As entradas de estado rodam uma vez por troca, então escrever sempre
+// não custa nada; alternar() inverte o nível real (escrita em PINx).
+typedef Pino<LED1_PIN, PINO_SAIDA> Led1;
+typedef Pino<LED2_PIN, PINO_SAIDA> Led2;
 
 #define TEMPO_TRANSICAO 5000
 #define INTERVALO_LED1 100
 #define INTERVALO_LED2 50
 #define INTERVALO_PRINT 1000
-
-int estadoAtual = IDLE;
+#define TELEMETRIA_BUFFER 256   // um status inteiro tem ~230 bytes
+#define INTERVALO_MAX 60000     // ms, maior período aceito pelo console
+
+// Tarefas periódicas na agenda; entre os prazos a CPU dorme em modo idle
+#define MAX_TAREFAS 6
+Agendador<MAX_TAREFAS> agenda(micros);
+unsigned long tempoDormindo = 0;
+unsigned long inicioPeriodo = 0;
+
+Telemetria<TELEMETRIA_BUFFER> telemetria;
+unsigned long emissaoUltima = 0;
+unsigned long emissaoMax = 0;
+
+// Filtros das leituras: mediana no sonar, mediana e média no LDR, e
+// histerese em todas as faixas para o ruído não ficar trocando o estado
+Mediana<5> filtroDist;
+Faixas<2, 10, 20, 50> faixasDist;               // cm
+Cadeia<Mediana<3>, MediaExp<3> > filtroLdr;     // ~80 ms a 100 Hz
+Faixas<5, 59> faixasLuz;                        // LDR abaixo de 60: obstáculo acima
+Faixas<10, 700> faixasUmid;                     // décimos de %: acima de 70%
+unsigned long leiturasDht = 0;
 
 int estadoDist = 0;
 int ultimoEstadoDist = -1;
@@ -52,69 +76,182 @@ int ultimoEstadoLuz = -1;
 int estadoUmid = 0;
 int ultimoEstadoUmid = -1;
 
-char lerComando() {
-  if (Serial.available() > 0) {
-    char cmd = Serial.read();
-    delay(10);
-    return cmd;
+// Medidas prontas do sonar: escritas pela interrupção, lidas no loop()
+struct MedidaSonar {
+  unsigned int cm;
+  unsigned long instante;   // micros() quando a medida ficou pronta
+};
+
+volatile MedidaSonar filaSonar[SONAR_FILA];
+volatile uint8_t filaInicio = 0;   // só o loop() altera
+volatile uint8_t filaFim = 0;      // só quem guarda altera
+volatile boolean ecoRecebido = false;
+boolean pingAtivo = false;
+
+// Últimos valores filtrados, enviados ao ESP32
+unsigned int ultimaDist = 0;
+int ultimoLdr = 0;
+
+Decodificador enlace;
+uint8_t seqSensores = 0;
+unsigned long ultimoQuadroEstado = 0;
+boolean medidaPendente = false;
+unsigned long instantePendente;
+unsigned long quadrosEnviados = 0;
+unsigned long quadrosSemEspaco = 0;
+
+// Estatísticas do status
+unsigned long voltasLoop = 0;
+unsigned long medidasSonar = 0;
+unsigned long latenciaSoma = 0;
+unsigned long latenciaMax = 0;
+volatile unsigned int medidasPerdidas = 0;
+
+// Histograma do tempo de cada volta do loop(), em us
+#define HIST_FAIXAS 6
+const unsigned long limitesHist[HIST_FAIXAS - 1] = {100, 500, 1000, 5000, 20000};
+unsigned long histLoop[HIST_FAIXAS];
+unsigned long loopMax = 0;
+
+void dhtBorda() {
+  dht.tratarBorda();
+}
+
+void registrarVolta(unsigned long duracao) {
+  int faixa = 0;
+  while (faixa < HIST_FAIXAS - 1 && duracao >= limitesHist[faixa]) faixa++;
+  histLoop[faixa]++;
+  if (duracao > loopMax) loopMax = duracao;
+}
+
+// Fila cheia: a medida nova é descartada
+void guardarMedida(unsigned int cm, unsigned long instante) {
+  uint8_t proximo = (filaFim + 1) % SONAR_FILA;
+  if (proximo == filaInicio) {
+    medidasPerdidas++;
+    return;
   }
-  return 0;
+  filaSonar[filaFim].cm = cm;
+  filaSonar[filaFim].instante = instante;
+  filaFim = proximo;
 }
 
-void mudarEstado(int novoEstado) {
-  estadoAtual = novoEstado;
-  timerEstado = millis();
+// Chamada pelo timer do NewPing a cada 24 us enquanto o ping está ativo
+void echoCheck() {
+  if (sonar.check_timer()) {
+    guardarMedida(sonar.ping_result / US_ROUNDTRIP_CM, micros());
+    ecoRecebido = true;
+  }
+}
+
+// Disparar um ping por intervalo; ping sem eco conta como nada no alcance
+void atualizarSonar() {
+#if SONAR_BLOQUEANTE
+  unsigned int cm = sonar.ping_cm();
+  guardarMedida(cm, micros());
+#else
+  if (pingAtivo && !ecoRecebido) {
+    // O timer já parou sozinho (timeout); a interrupção não escreve agora
+    guardarMedida(0, micros());
+  }
+  ecoRecebido = false;
+  pingAtivo = true;
+  sonar.ping_timer(echoCheck);
+#endif
+}
 
-  Serial.print("Estado alterado para: ");
-  if (novoEstado == IDLE) Serial.println("IDLE");
-  else if (novoEstado == CLEAN) Serial.println("CLEAN");
-  else if (novoEstado == DOCK) Serial.println("DOCK");
-  else if (novoEstado == CHRG) Serial.println("CHRG");
+boolean lerMedida(unsigned int &cm, unsigned long &instante) {
+  if (filaInicio == filaFim) {
+    return false;
+  }
+  cm = filaSonar[filaInicio].cm;
+  instante = filaSonar[filaInicio].instante;
+  filaInicio = (filaInicio + 1) % SONAR_FILA;
+  return true;
 }
 
+// Entradas de estado: o LED fixo de cada estado; os que piscam ficam com
+// as tarefas piscarLED1/piscarLED2
 void idle() {
-  digitalWrite(LED1_PIN, HIGH);
-  digitalWrite(LED2_PIN, HIGH);
+  Led1::escrever(HIGH);
+  Led2::escrever(HIGH);
 }
 
 void cleaning() {
-  digitalWrite(LED2_PIN, HIGH);
-  if (millis() - timerLED1 >= INTERVALO_LED1) {
-    estadoLED1 = !estadoLED1;
-    digitalWrite(LED1_PIN, estadoLED1);
-    timerLED1 = millis();
-  }
+  Led2::escrever(HIGH);
 }
 
 void docking() {
-  digitalWrite(LED1_PIN, HIGH);
-  if (millis() - timerLED2 >= INTERVALO_LED2) {
-    estadoLED2 = !estadoLED2;
-    digitalWrite(LED2_PIN, estadoLED2);
-    timerLED2 = millis();
-  }
+  Led1::escrever(HIGH);
 }
 
-void charging() {
-  if (millis() - timerLED1 >= INTERVALO_LED1) {
-    estadoLED1 = !estadoLED1;
-    digitalWrite(LED1_PIN, estadoLED1);
-    timerLED1 = millis();
+// O estado vem do ESP32 (irPara); o único evento local é a perda do enlace
+enum EventoRobo : uint8_t {
+  EV_ENLACE_PERDIDO,
+  N_EVENTOS
+};
+
+bool enlacePerdido() {
+  return millis() - ultimoQuadroEstado >= ENLACE_TIMEOUT;
+}
+
+// Nomes na flash: um literal dentro da tabela PROGMEM ficaria na SRAM
+const char nomeIdle[] PROGMEM = "IDLE";
+const char nomeClean[] PROGMEM = "CLEAN";
+const char nomeDock[] PROGMEM = "DOCK";
+const char nomeChrg[] PROGMEM = "CHRG";
+
+const AcoesEstado estadosRobo[N_ESTADOS] PROGMEM = {
+  //  nome       entrada   executar  saída
+  { nomeIdle,  idle,     NULL,     NULL },
+  { nomeClean, cleaning, NULL,     NULL },
+  { nomeDock,  docking,  NULL,     NULL },
+  { nomeChrg,  NULL,     NULL,     NULL },
+};
+
+const Transicao transicoesRobo[N_ESTADOS][N_EVENTOS] PROGMEM = {
+  //           EV_ENLACE_PERDIDO
+  /* IDLE  */ { { FSM_SEM_TRANSICAO, NULL } },
+  /* CLEAN */ { { IDLE, enlacePerdido } },
+  /* DOCK  */ { { IDLE, enlacePerdido } },
+  /* CHRG  */ { { IDLE, enlacePerdido } },
+};
+
+void registrarEstado();
+
+void mudarEstado(uint8_t de, uint8_t para) {
+  registrarEstado();
+}
+
+Maquina<N_ESTADOS, N_EVENTOS> robo(estadosRobo, transicoesRobo, mudarEstado);
+
+void piscarLED1() {
+  if (robo.atual() == CLEAN || robo.atual() == CHRG) {
+    Led1::alternar();
   }
-  if (millis() - timerLED2 >= INTERVALO_LED2) {
-    estadoLED2 = !estadoLED2;
-    digitalWrite(LED2_PIN, estadoLED2);
-    timerLED2 = millis();
+}
+
+void piscarLED2() {
+  if (robo.atual() == DOCK || robo.atual() == CHRG) {
+    Led2::alternar();
   }
 }
 
 void lerSensores() {
-  unsigned int dist = sonar.ping_cm();
-  if (dist == 0) dist = HC_MAX_DISTANCE;
-  if (dist > 50) estadoDist = 0;
-  else if (dist > 20) estadoDist = 1;
-  else if (dist > 10) estadoDist = 2;
-  else estadoDist = 3;
+  unsigned int dist;
+  unsigned long instante;
+  while (lerMedida(dist, instante)) {
+    if (!medidaPendente) {
+      medidaPendente = true;
+      instantePendente = instante;
+    }
+
+    if (dist == 0) dist = HC_MAX_DISTANCE;
+    int16_t cm = filtroDist.filtrar(dist);
+    ultimaDist = (cm >= HC_MAX_DISTANCE) ? 0 : cm;
+    estadoDist = 3 - faixasDist.filtrar(cm);
+    medidasSonar++;
+  }
 
   if (estadoDist != ultimoEstadoDist) {
     // Serial.print("Distância mudou para: ");
@@ -125,8 +262,9 @@ void lerSensores() {
     ultimoEstadoDist = estadoDist;
   }
 
-  int ldrValue = analogRead(LDR_PIN);
-  estadoLuz = (ldrValue < 60) ? 1 : 0;
+  int ldrValue = filtroLdr.filtrar(analogRead(LDR_PIN));
+  ultimoLdr = ldrValue;
+  estadoLuz = (faixasLuz.filtrar(ldrValue) == 0) ? 1 : 0;
   if (estadoLuz != ultimoEstadoLuz) {
     // Serial.print("Luminosidade mudou para: ");
     // if (estadoLuz == 0) Serial.println("Sem obstáculo acima");
@@ -134,9 +272,11 @@ void lerSensores() {
     ultimoEstadoLuz = estadoLuz;
   }
 
-  float h = dht.readHumidity();     
-  if (!isnan(h)) {
-    estadoUmid = (h > 70.0) ? 1 : 0;
+  // Valor em cache; a leitura de verdade anda em dht.atualizar() e só
+  // leitura nova passa pela histerese
+  if (dht.valido() && dht.leituras() != leiturasDht) {
+    leiturasDht = dht.leituras();
+    estadoUmid = faixasUmid.filtrar(dht.umidade());
     if (estadoUmid != ultimoEstadoUmid) {
       // Serial.print("Umidade mudou para: ");
       // if (estadoUmid == 0) Serial.println("Aceitável");
@@ -149,78 +289,231 @@ void lerSensores() {
   // Serial.println(estadoLuz);
   // Serial.println(estadoUmid);
   // Serial.println(" ");
-  
-  digitalWrite(DIST_PIN0, estadoDist & 0x01);
-  digitalWrite(DIST_PIN1, (estadoDist >> 1) & 0x01);
-  digitalWrite(LUZ_PIN, estadoLuz);
-  digitalWrite(UMID_PIN, estadoUmid);
 }
 
-void setup() {
-  Serial.begin(115200);
-  pinMode(LED1_PIN, OUTPUT);
-  pinMode(LED2_PIN, OUTPUT);
-  pinMode(DATAPATH1_PIN, INPUT);
-  pinMode(DATAPATH2_PIN, INPUT);
-
-  pinMode(DIST_PIN0, OUTPUT);
-  pinMode(DIST_PIN1, OUTPUT);
-  pinMode(LUZ_PIN, OUTPUT);
-  pinMode(UMID_PIN, OUTPUT);
+// Quadro de sensores a cada ENVIO_INTERVALO; sem espaço no buffer do
+// Serial1 o quadro é pulado (o próximo leva valores mais novos)
+void enviarSensores() {
+  PayloadSensores p;
+  p.instante = millis();
+  p.distCm = ultimaDist;
+  p.ldr = ultimoLdr;
+  p.flags = (dht.valido() ? SENSOR_DHT_VALIDO : 0) |
+            ((estadoDist << SENSOR_DIST_SHIFT) & SENSOR_DIST_FAIXA) |
+            (estadoLuz ? SENSOR_LUZ : 0) | (estadoUmid ? SENSOR_UMIDADE_ALTA : 0);
+  p.umidade = dht.umidade();
+  p.temperatura = dht.temperatura();
+  unsigned long idade = dht.valido() ? dht.idade() : 0xFFFF;
+  p.idadeDht = (idade > 0xFFFF) ? 0xFFFF : idade;
+
+  uint8_t quadro[PROTO_OVERHEAD + sizeof(PayloadSensores)];
+  size_t tamanho = montarQuadro(quadro, QUADRO_SENSORES, seqSensores, &p, sizeof(p));
+  if ((size_t)Serial1.availableForWrite() < tamanho) {
+    quadrosSemEspaco++;
+    return;
+  }
+  Serial1.write(quadro, tamanho);
+  seqSensores++;
+  quadrosEnviados++;
+
+  // Latência da medida do sonar pronta até o quadro que a leva
+  if (medidaPendente) {
+    unsigned long latencia = micros() - instantePendente;
+    latenciaSoma += latencia;
+    if (latencia > latenciaMax) latenciaMax = latencia;
+    medidaPendente = false;
+  }
+}
 
-  dht.begin();
+// Estado do robô vindo do ESP32 (no lugar dos pinos DATAPATH)
+void receberEstado() {
+  while (Serial1.available() > 0) {
+    if (!enlace.receber(Serial1.read())) continue;
 
-  timerEstado = millis();
-  timerLED1 = millis();
-  timerLED2 = millis();
-  timerPrint = millis();
+    PayloadEstado p;
+    if (enlace.tipo() == QUADRO_ESTADO && enlace.ler(&p, sizeof(p))) {
+      ultimoQuadroEstado = millis();
+      if (p.estado != robo.atual()) robo.irPara(p.estado);
+    }
+  }
 
-  Serial.println("Roomba Inicializado!");
-  Serial.println("Comandos: 'a' = Clean, 'b' = Dock");
-  Serial.println("Estado atual: IDLE");
+  robo.disparar(EV_ENLACE_PERDIDO);
 }
 
-void loop() {
-  char comando = lerComando();
+void amostrarSensores() {
+  lerSensores();
+  enviarSensores();
+}
 
-  if (!digitalRead(DATAPATH1_PIN) && digitalRead(DATAPATH2_PIN)) {
-    cleaning();
+// Idle: a CPU para e os periféricos seguem; qualquer interrupção acorda
+// (timer0 a cada ~1 ms, USB, Serial1, sonar, DHT)
+void dormir(uint32_t espera) {
+  if (espera == 0) {
+    return;
   }
-  if (digitalRead(DATAPATH1_PIN) && !digitalRead(DATAPATH2_PIN)) {
-    docking();
+  unsigned long inicio = micros();
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_mode();
+  tempoDormindo += micros() - inicio;
+}
+
+void registrarEstado() {
+  RegistroEstado r;
+  memset(&r, 0, sizeof(r));
+  r.instante = millis();
+  r.origem = ORIGEM_ARDUINO;
+  r.estado = robo.atual();
+  r.flags = (estadoDist & TLM_DIST_FAIXA) | (estadoLuz ? TLM_LUZ : 0) |
+            (estadoUmid ? TLM_UMIDADE_ALTA : 0) | (dht.valido() ? TLM_DHT_VALIDO : 0);
+  r.falhasDht = (dht.falhas() > 255) ? 255 : dht.falhas();
+  r.distCm = ultimaDist;
+  r.ldr = ultimoLdr;
+  r.umidade = dht.umidade();
+  r.temperatura = dht.temperatura();
+  r.idadeDht = dht.valido() ? saturar16(dht.idade()) : 0xFFFF;
+  telemetria.registrar(TLM_ESTADO, &r, sizeof(r));
+}
+
+// Status de 1 Hz em registros binários; o tempo que isso segura o loop
+// vai no registro do loop da próxima emissão
+void emitirTelemetria() {
+  unsigned long inicio = micros();
+  unsigned long periodo = inicio - inicioPeriodo;
+
+  registrarEstado();
+
+  RegistroLoop l;
+  l.voltasHz = voltasLoop * 1000UL / (periodo / 1000 + 1);
+  l.loopMax = saturar16(loopMax);
+  for (int k = 0; k < HIST_FAIXAS; k++) {
+    l.hist[k] = saturar16(histLoop[k]);
+    histLoop[k] = 0;
   }
-  if (digitalRead(DATAPATH1_PIN) && digitalRead(DATAPATH2_PIN)) {
-    charging();
+  l.emissaoUltima = saturar16(emissaoUltima);
+  l.emissaoMax = saturar16(emissaoMax);
+  l.descartados = telemetria.descartados;
+  l.ocioso = tempoDormindo / (periodo / 100 + 1);
+  l.reservado = 0;
+  telemetria.registrar(TLM_LOOP, &l, sizeof(l));
+
+  for (uint8_t id = 0; id < agenda.total(); id++) {
+    const Tarefa& t = agenda.tarefa(id);
+    RegistroTarefa r;
+    r.id = id;
+    strncpy_P(r.nome, t.nome, TLM_NOME_TAREFA);
+    r.execucoes = t.execucoes;
+    r.atrasoMedio = t.execucoes ? t.atrasoSoma / t.execucoes : 0;
+    r.atrasoMax = t.atrasoMax;
+    telemetria.registrar(TLM_TAREFA, &r, sizeof(r));
   }
-  if (!digitalRead(DATAPATH1_PIN) && !digitalRead(DATAPATH2_PIN)) {
-    idle();
+  agenda.zerarEstatisticas();
+
+  RegistroLatencia sonar;
+  sonar.eventos = saturar16(medidasSonar);
+  sonar.perdidos = medidasPerdidas;
+  sonar.media = medidasSonar ? latenciaSoma / medidasSonar : 0;
+  sonar.max = latenciaMax;
+  telemetria.registrar(TLM_LATENCIA, &sonar, sizeof(sonar));
+
+  RegistroEnlace e;
+  e.enviados = saturar16(quadrosEnviados);
+  e.semEspaco = saturar16(quadrosSemEspaco);
+  e.recebidos = enlace.recebidos;
+  e.erros = enlace.erros;
+  e.perdidos = enlace.perdidos;
+  e.descartados = enlace.descartados;
+  telemetria.registrar(TLM_ENLACE, &e, sizeof(e));
+
+  quadrosEnviados = 0;
+  quadrosSemEspaco = 0;
+  voltasLoop = 0;
+  medidasSonar = 0;
+  latenciaSoma = 0;
+  latenciaMax = 0;
+  medidasPerdidas = 0;
+  loopMax = 0;
+  tempoDormindo = 0;
+  inicioPeriodo = inicio;
+
+  emissaoUltima = micros() - inicio;
+  if (emissaoUltima > emissaoMax) emissaoMax = emissaoUltima;
+}
+
+// Comandos do console; o estado do robô é do ESP32, aqui só consulta e
+// períodos das tarefas
+uint8_t cmdIntervalo(uint8_t argc, char* argv[]) {
+  uint32_t ms;
+  uint8_t id = agenda.procurar(argv[1]);
+  if (id == AGENDA_NENHUMA || !lerNumero(argv[2], ms) || ms == 0 || ms > INTERVALO_MAX) {
+    return CONSOLE_ARG_INVALIDO;
   }
+  return agenda.mudarPeriodo(id, ms * 1000UL) ? CONSOLE_OK : CONSOLE_ARG_INVALIDO;
+}
 
-  lerSensores();
+uint8_t cmdSensores(uint8_t argc, char* argv[]) {
+  registrarEstado();
+  return CONSOLE_OK;
+}
 
-  if (millis() - timerPrint >= INTERVALO_PRINT) {
-    Serial.println("---------- STATUS ----------");
-    Serial.print("Estado do robô: ");
-    if (estadoAtual == IDLE) Serial.println("IDLE");
-    else if (estadoAtual == CLEAN) Serial.println("CLEAN");
-    else if (estadoAtual == DOCK) Serial.println("DOCK");
-    else if (estadoAtual == CHRG) Serial.println("CHARGING");
+uint8_t cmdStats(uint8_t argc, char* argv[]) {
+  emitirTelemetria();
+  return CONSOLE_OK;
+}
 
-    Serial.print("Distância: ");
-    if (estadoDist == 0) Serial.println("Sem obstáculo");
-    else if (estadoDist == 1) Serial.println("Obstáculo longe");
-    else if (estadoDist == 2) Serial.println("Obstáculo meia distância");
-    else Serial.println("Obstáculo perto");
+const char nomeIntervalo[] PROGMEM = "intervalo";
+const char nomeSensores[] PROGMEM = "sensores";
+const char nomeStats[] PROGMEM = "stats";
 
-    Serial.print("Luminosidade: ");
-    if (estadoLuz == 0) Serial.println("Sem obstáculo acima");
-    else Serial.println("Obstáculo acima");
+const Comando comandos[] PROGMEM = {
+  { nomeIntervalo, 2, cmdIntervalo },
+  { nomeSensores,  0, cmdSensores },
+  { nomeStats,     0, cmdStats },
+};
 
-    Serial.print("Umidade: ");
-    if (estadoUmid == 0) Serial.println("Aceitável");
-    else Serial.println("Não aceitável");
+Console<sizeof(comandos) / sizeof(comandos[0])> console(comandos);
 
-    Serial.println("----------------------------");
-    timerPrint = millis();
-  }
+void responder(uint8_t resultado) {
+  RegistroResposta r;
+  memset(&r, 0, sizeof(r));
+  r.resultado = resultado;
+  strncpy(r.comando, console.nome(), TLM_NOME_TAREFA);
+  telemetria.registrar(TLM_RESPOSTA, &r, sizeof(r));
+}
+
+void setup() {
+  Serial.begin(115200);
+  Led1::iniciar();
+  Led2::iniciar();
+  Serial1.begin(PROTO_BAUD);
+
+  dht.begin(dhtBorda);
+
+  inicioPeriodo = micros();
+  robo.iniciar(IDLE);
+
+  agenda.periodica(PSTR("sonar"), atualizarSonar, PING_INTERVALO * 1000UL);
+  agenda.periodica(PSTR("sensor"), amostrarSensores, ENVIO_INTERVALO * 1000UL);
+  agenda.periodica(PSTR("led1"), piscarLED1, INTERVALO_LED1 * 1000UL);
+  agenda.periodica(PSTR("led2"), piscarLED2, INTERVALO_LED2 * 1000UL);
+  agenda.periodica(PSTR("status"), emitirTelemetria, INTERVALO_PRINT * 1000UL);
+
+  // Texto só na partida; depois a serial leva telemetria binária
+  Serial.println(F("Roomba Inicializado! (telemetria: tools/telemetria.py)"));
+  Serial.println(F("Comandos: intervalo <tarefa> <ms>, sensores, stats"));
+}
+
+void loop() {
+  unsigned long inicioVolta = micros();
+  uint8_t resultado = console.ler(Serial);
+  if (resultado != CONSOLE_NADA) responder(resultado);
+  receberEstado();
+  robo.executar();
+  dht.atualizar();
+
+  uint32_t espera = agenda.executar();
+  telemetria.drenar(Serial);
+  voltasLoop++;
+  registrarVolta(micros() - inicioVolta);
+
+  dormir(espera);
 }
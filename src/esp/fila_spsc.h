@@ -0,0 +1,39 @@
+#ifndef ESP_FILA_SPSC_H
+#define ESP_FILA_SPSC_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Fila de um produtor e um consumidor sem trava: só o produtor escreve
+// fim_ e só o consumidor escreve inicio_. N precisa ser potência de 2; os
+// índices crescem livres e a posição é o índice & (N - 1).
+template <typename T, uint32_t N>
+class FilaSpsc {
+  static_assert((N & (N - 1)) == 0, "N precisa ser potência de 2");
+
+ public:
+  // Produtor; false com a fila cheia
+  bool colocar(const T& item) {
+    uint32_t fim = fim_.load(std::memory_order_relaxed);
+    if (fim - inicio_.load(std::memory_order_acquire) == N) return false;
+    itens_[fim & (N - 1)] = item;
+    fim_.store(fim + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumidor; false com a fila vazia
+  bool tirar(T& item) {
+    uint32_t inicio = inicio_.load(std::memory_order_relaxed);
+    if (inicio == fim_.load(std::memory_order_acquire)) return false;
+    item = itens_[inicio & (N - 1)];
+    inicio_.store(inicio + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  T itens_[N];
+  std::atomic<uint32_t> inicio_{0};
+  std::atomic<uint32_t> fim_{0};
+};
+
+#endif
@@ -1,190 +1,424 @@
 #include "Arduino.h"
-
-#define IDLE 0
-#define CLEAN 1
-#define DOCK 2
-#define CHRG 3
+#include "protocolo.h"
+#include "roomba.h"
+#include "fsm.h"
+#include "agenda.h"
+#include "telemetria.h"
+#include "pino.h"
+#include "console.h"
+#include "fila_spsc.h"
 
 #define LED1_PIN 2
 #define LED2_PIN 4
 #define BATERY_LED 26
-#define DATAPATH1_PIN 13
-#define DATAPATH2_PIN 12
 
-#define DIST_PIN0 32
-#define DIST_PIN1 33
-#define LUZ_PIN   34
-#define UMID_PIN  35
+// Enlace com o Arduino no Serial2
+#define ENLACE_RX_PIN 16
+#define ENLACE_TX_PIN 17
+#define ESTADO_INTERVALO 100    // ms entre quadros de estado (e logo ao mudar)
+#define SENSORES_TIMEOUT 500    // ms sem quadro de sensores: dados velhos
+#define FILA_SENSORES 32
 
-int estadoAtual = IDLE;
 unsigned long timerEstado;
-unsigned long timerLED1;
-unsigned long timerLED2;
-unsigned long timerPrint;
 
 unsigned long duracao;
-boolean estadoLED1 = false;
-boolean estadoLED2 = false;
+SaidaSombra<LED1_PIN> led1;
+SaidaSombra<LED2_PIN> led2;
 
 #define TEMPO_TRANSICAO 5000
 #define INTERVALO_LED1 100
 #define INTERVALO_LED2 50
 #define INTERVALO_PRINT 1000
+#define INTERVALO_BATERIA 20    // ms entre atualizações do DAC da bateria
+#define TELEMETRIA_BUFFER 512
+#define INTERVALO_MAX 60000     // ms, maior período aceito pelo console
 
-char lerComando() {
-  if (Serial.available() > 0) {
-    char cmd = Serial.read();
-    delay(10);
-    return cmd;
-  }
-  return 0;
-}
+// Tudo que é periódico roda pela agenda; entre os prazos a tarefa do
+// loop() fica bloqueada (o callback do Serial2 a acorda antes)
+#define MAX_TAREFAS 8
+Agendador<MAX_TAREFAS> agenda(micros);
+uint8_t tarefaTempo;
+TaskHandle_t tarefaLoop = NULL;
+unsigned long tempoDormindo = 0;
+unsigned long inicioPeriodo = 0;
+unsigned long voltasLoop = 0;
 
-void mudarEstado(int novoEstado) {
-  estadoAtual = novoEstado;
-  timerEstado = millis();
+Telemetria<TELEMETRIA_BUFFER> telemetria;
+unsigned long emissaoUltima = 0;
+unsigned long emissaoMax = 0;
 
-  Serial.print("Estado alterado para: ");
-  if (novoEstado == IDLE) Serial.println("IDLE");
-  else if (novoEstado == CLEAN) Serial.println("CLEAN");
-  else if (novoEstado == DOCK) Serial.println("DOCK");
-  else if (novoEstado == CHRG) Serial.println("CHRG");
-}
+// Quadros decodificados no callback do Serial2 (tarefa de eventos da UART)
+// e consumidos no loop(); o instante é o micros() da chegada
+struct EventoSensores {
+  unsigned long instante;
+  PayloadSensores sensores;
+};
+
+FilaSpsc<EventoSensores, FILA_SENSORES> filaSensores;
+Decodificador enlace;           // só o callback usa (o status só lê os contadores)
+volatile uint32_t quadrosSemFila = 0;
+
+PayloadSensores sensores;
+int faixaDist = 0;              // 0 sem obstáculo .. 3 perto
+boolean obstaculoPerto = false;
+unsigned long ultimoQuadroSensores = 0;
+boolean temSensores = false;
+uint8_t seqEstado = 0;
+unsigned long quadrosEstado = 0;
+unsigned long quadrosSensores = 0;
+
+// Latência da chegada do quadro até a reação no loop()
+unsigned long reacoes = 0;
+unsigned long latenciaSoma = 0;
+unsigned long latenciaMax = 0;
 
 void idle() {
-  digitalWrite(LED1_PIN, LOW);
-  digitalWrite(LED2_PIN, LOW);
-  digitalWrite(DATAPATH1_PIN, LOW);
-  digitalWrite(DATAPATH2_PIN, LOW);
+  led1.escrever(LOW);
+  led2.escrever(LOW);
 }
 
 void cleaning() {
   dacWrite(BATERY_LED, 255 - duracao / (float)TEMPO_TRANSICAO * 255);
-  digitalWrite(DATAPATH1_PIN, HIGH);
-  digitalWrite(DATAPATH2_PIN, LOW);
-  digitalWrite(LED2_PIN, LOW);
-
-  if (millis() - timerLED1 >= INTERVALO_LED1) {
-    estadoLED1 = !estadoLED1;
-    digitalWrite(LED1_PIN, estadoLED1);
-    timerLED1 = millis();
-  }
+  led2.escrever(obstaculoPerto);
 }
 
 void docking() {
-  digitalWrite(DATAPATH1_PIN, LOW);
-  digitalWrite(DATAPATH2_PIN, HIGH);
-  digitalWrite(LED1_PIN, LOW);
-
-  if (millis() - timerLED2 >= INTERVALO_LED2) {
-    estadoLED2 = !estadoLED2;
-    digitalWrite(LED2_PIN, estadoLED2);
-    timerLED2 = millis();
-  }
+  led1.escrever(LOW);
 }
 
 void charging() {
   dacWrite(BATERY_LED, duracao / (float)TEMPO_TRANSICAO * 255);
-  digitalWrite(DATAPATH1_PIN, HIGH);
-  digitalWrite(DATAPATH2_PIN, HIGH);
+}
+
+// Eventos que movem o robô; EV_TEMPO vem da tarefa única armada a cada
+// troca de estado
+enum EventoRobo : uint8_t {
+  EV_LIMPAR,      // comando 'limpar' (ou 'a')
+  EV_DOCAR,       // comando 'docar' (ou 'b')
+  EV_TEMPO,
+  N_EVENTOS
+};
+
+// Nomes na flash: um literal dentro da tabela PROGMEM ficaria na SRAM
+const char nomeIdle[] PROGMEM = "IDLE";
+const char nomeClean[] PROGMEM = "CLEAN";
+const char nomeDock[] PROGMEM = "DOCK";
+const char nomeChrg[] PROGMEM = "CHRG";
+
+const AcoesEstado estadosRobo[N_ESTADOS] PROGMEM = {
+  //  nome       entrada  executar   saída
+  { nomeIdle,  idle,    NULL,      NULL },
+  { nomeClean, NULL,    cleaning,  NULL },
+  { nomeDock,  NULL,    docking,   NULL },
+  { nomeChrg,  NULL,    charging,  NULL },
+};
+
+#define SEM_TRANSICAO { FSM_SEM_TRANSICAO, NULL }
+
+const Transicao transicoesRobo[N_ESTADOS][N_EVENTOS] PROGMEM = {
+  //           EV_LIMPAR          EV_DOCAR           EV_TEMPO
+  /* IDLE  */ { { CLEAN, NULL },   SEM_TRANSICAO,     SEM_TRANSICAO },
+  /* CLEAN */ { SEM_TRANSICAO,     { DOCK, NULL },    { DOCK, NULL } },
+  /* DOCK  */ { SEM_TRANSICAO,     SEM_TRANSICAO,     { CHRG, NULL } },
+  /* CHRG  */ { { CLEAN, NULL },   SEM_TRANSICAO,     { IDLE, NULL } },
+};
+
+void enviarEstado();
+void registrarEstado();
+
+void mudarEstado(uint8_t de, uint8_t para) {
+  timerEstado = millis();
+  duracao = 0;
+  agenda.armar(tarefaTempo, TEMPO_TRANSICAO * 1000UL);
+  enviarEstado();
+  registrarEstado();
+}
+
+Maquina<N_ESTADOS, N_EVENTOS> robo(estadosRobo, transicoesRobo, mudarEstado);
 
-  if (millis() - timerLED1 >= INTERVALO_LED1) {
-    estadoLED1 = !estadoLED1;
-    digitalWrite(LED1_PIN, estadoLED1);
-    timerLED1 = millis();
+void fimDoTempo() {
+  robo.disparar(EV_TEMPO);
+}
+
+void atualizarEstado() {
+  duracao = millis() - timerEstado;
+  robo.executar();
+}
+
+// LED1 pisca na limpeza e na carga, LED2 na volta para a base e na carga
+void piscarLED1() {
+  if (robo.atual() == CLEAN || robo.atual() == CHRG) {
+    led1.alternar();
   }
+}
 
-  if (millis() - timerLED2 >= INTERVALO_LED2) {
-    estadoLED2 = !estadoLED2;
-    digitalWrite(LED2_PIN, estadoLED2);
-    timerLED2 = millis();
+void piscarLED2() {
+  if (robo.atual() == DOCK || robo.atual() == CHRG) {
+    led2.alternar();
   }
 }
 
-void setup() {
-  Serial.begin(115200);
-  pinMode(LED1_PIN, OUTPUT);
-  pinMode(LED2_PIN, OUTPUT);
-  pinMode(DATAPATH1_PIN, OUTPUT);
-  pinMode(DATAPATH2_PIN, OUTPUT);
+// Estado do robô para o Arduino: logo que muda (mudarEstado) e depois a
+// cada ESTADO_INTERVALO, para ele se recuperar de quadros perdidos
+void enviarEstado() {
+  PayloadEstado p;
+  memset(&p, 0, sizeof(p));
+  p.instante = millis();
+  p.estado = robo.atual();
 
-  pinMode(DIST_PIN0, INPUT);
-  pinMode(DIST_PIN1, INPUT);
-  pinMode(LUZ_PIN, INPUT);
-  pinMode(UMID_PIN, INPUT);
+  uint8_t quadro[PROTO_OVERHEAD + sizeof(PayloadEstado)];
+  size_t tamanho = montarQuadro(quadro, QUADRO_ESTADO, seqEstado++, &p, sizeof(p));
+  Serial2.write(quadro, tamanho);
+  quadrosEstado++;
+}
 
-  timerEstado = millis();
-  timerLED1 = millis();
-  timerLED2 = millis();
-  timerPrint = millis();
+void acordarLoop() {
+  if (tarefaLoop) xTaskNotifyGive(tarefaLoop);
+}
 
-  Serial.println("Roomba Inicializado!");
-  Serial.println("Comandos: 'a' = Clean, 'b' = Dock");
-  Serial.println("Estado atual: IDLE");
+// Callback do Serial2: chamado quando chegam bytes, sem esperar o loop()
+void aoReceber() {
+  unsigned long agora = micros();
+  while (Serial2.available() > 0) {
+    if (!enlace.receber(Serial2.read())) continue;
+
+    EventoSensores evento;
+    if (enlace.tipo() == QUADRO_SENSORES && enlace.ler(&evento.sensores, sizeof(evento.sensores))) {
+      evento.instante = agora;
+      if (!filaSensores.colocar(evento)) quadrosSemFila++;
+    }
+  }
+  acordarLoop();
 }
 
-void loop() {
-  char comando = lerComando();
-  duracao = millis() - timerEstado;
+// Obstáculo mudou de faixa: o LED de obstáculo da limpeza reage na hora
+void reagirObstaculo(int faixa) {
+  faixaDist = faixa;
+  obstaculoPerto = (faixa == 3);
+  if (robo.atual() == CLEAN) {
+    led2.escrever(obstaculoPerto);
+  }
+}
+
+void processarSensores() {
+  EventoSensores evento;
+  while (filaSensores.tirar(evento)) {
+    sensores = evento.sensores;
+    ultimoQuadroSensores = millis();
+    temSensores = true;
+    quadrosSensores++;
+
+    // Faixa já filtrada e com histerese no Arduino
+    int faixa = (sensores.flags & SENSOR_DIST_FAIXA) >> SENSOR_DIST_SHIFT;
+    if (faixa != faixaDist) {
+      reagirObstaculo(faixa);
+      unsigned long latencia = micros() - evento.instante;
+      latenciaSoma += latencia;
+      if (latencia > latenciaMax) latenciaMax = latencia;
+      reacoes++;
+    }
+  }
+}
 
+// Estado do robô com os últimos sensores vindos do Arduino
+void registrarEstado() {
+  RegistroEstado r;
+  memset(&r, 0, sizeof(r));
+  r.instante = millis();
+  r.origem = ORIGEM_ESP32;
+  r.estado = robo.atual();
+  if (temSensores && millis() - ultimoQuadroSensores < SENSORES_TIMEOUT) {
+    r.flags = (faixaDist & TLM_DIST_FAIXA) | ((sensores.flags & SENSOR_LUZ) ? TLM_LUZ : 0) |
+              ((sensores.flags & SENSOR_UMIDADE_ALTA) ? TLM_UMIDADE_ALTA : 0) |
+              ((sensores.flags & SENSOR_DHT_VALIDO) ? TLM_DHT_VALIDO : 0);
+    r.distCm = sensores.distCm;
+    r.ldr = sensores.ldr;
+    r.umidade = sensores.umidade;
+    r.temperatura = sensores.temperatura;
+    r.idadeDht = sensores.idadeDht;
+  } else {
+    r.flags = TLM_SEM_SENSORES;
+    r.idadeDht = 0xFFFF;
+  }
+  telemetria.registrar(TLM_ESTADO, &r, sizeof(r));
+}
+
+// Status de 1 Hz em registros binários; o tempo que isso segura o loop
+// vai no registro do loop da próxima emissão
+void emitirTelemetria() {
+  unsigned long inicio = micros();
+  unsigned long periodo = inicio - inicioPeriodo;
 
-  switch (estadoAtual) {
-    case IDLE:
-      idle();
-      if (comando == 'a') mudarEstado(CLEAN);
-      break;
-    case CLEAN:
-      cleaning();
-      if (comando == 'b') mudarEstado(DOCK);
-      else if (duracao >= TEMPO_TRANSICAO) mudarEstado(DOCK);
-      break;
-    case DOCK:
-      docking();
-      if (duracao >= TEMPO_TRANSICAO) mudarEstado(CHRG);
-      break;
-    case CHRG:
-      charging();
-      if (comando == 'a') mudarEstado(CLEAN);
-      else if (duracao >= TEMPO_TRANSICAO) mudarEstado(IDLE);
-      break;
-    default:
-      mudarEstado(IDLE);
-      break;
+  registrarEstado();
+
+  RegistroLoop l;
+  memset(&l, 0, sizeof(l));
+  l.voltasHz = voltasLoop * 1000UL / (periodo / 1000 + 1);
+  l.emissaoUltima = saturar16(emissaoUltima);
+  l.emissaoMax = saturar16(emissaoMax);
+  l.descartados = telemetria.descartados;
+  l.ocioso = tempoDormindo / (periodo / 100 + 1);
+  telemetria.registrar(TLM_LOOP, &l, sizeof(l));
+
+  for (uint8_t id = 0; id < agenda.total(); id++) {
+    const Tarefa& t = agenda.tarefa(id);
+    RegistroTarefa r;
+    r.id = id;
+    strncpy_P(r.nome, t.nome, TLM_NOME_TAREFA);
+    r.execucoes = t.execucoes;
+    r.atrasoMedio = t.execucoes ? t.atrasoSoma / t.execucoes : 0;
+    r.atrasoMax = t.atrasoMax;
+    telemetria.registrar(TLM_TAREFA, &r, sizeof(r));
   }
+  agenda.zerarEstatisticas();
+
+  RegistroLatencia reacao;
+  reacao.eventos = saturar16(reacoes);
+  reacao.perdidos = saturar16(quadrosSemFila);
+  reacao.media = reacoes ? latenciaSoma / reacoes : 0;
+  reacao.max = latenciaMax;
+  telemetria.registrar(TLM_LATENCIA, &reacao, sizeof(reacao));
+
+  RegistroEnlace e;
+  e.enviados = saturar16(quadrosEstado);
+  e.semEspaco = 0;
+  e.recebidos = enlace.recebidos;
+  e.erros = enlace.erros;
+  e.perdidos = enlace.perdidos;
+  e.descartados = enlace.descartados;
+  telemetria.registrar(TLM_ENLACE, &e, sizeof(e));
+
+  quadrosEstado = 0;
+  reacoes = 0;
+  latenciaSoma = 0;
+  latenciaMax = 0;
+  voltasLoop = 0;
+  tempoDormindo = 0;
+  inicioPeriodo = inicio;
+
+  emissaoUltima = micros() - inicio;
+  if (emissaoUltima > emissaoMax) emissaoMax = emissaoUltima;
+}
+
+// Comandos do console; rodam no loop(), entre as passadas da agenda, e
+// só mexem no estado e nos períodos, nunca esperam
+uint8_t cmdLimpar(uint8_t argc, char* argv[]) {
+  robo.disparar(EV_LIMPAR);
+  return CONSOLE_OK;
+}
+
+uint8_t cmdDocar(uint8_t argc, char* argv[]) {
+  robo.disparar(EV_DOCAR);
+  return CONSOLE_OK;
+}
+
+// Força o estado, sem passar pela tabela de transições
+uint8_t cmdEstado(uint8_t argc, char* argv[]) {
+  for (uint8_t e = 0; e < N_ESTADOS; e++) {
+    if (strcasecmp_P(argv[1], robo.nome(e)) == 0) {
+      robo.irPara(e);
+      return CONSOLE_OK;
+    }
+  }
+  return CONSOLE_ARG_INVALIDO;
+}
+
+// intervalo <tarefa> <ms>: período novo a partir de agora
+uint8_t cmdIntervalo(uint8_t argc, char* argv[]) {
+  uint32_t ms;
+  uint8_t id = agenda.procurar(argv[1]);
+  if (id == AGENDA_NENHUMA || !lerNumero(argv[2], ms) || ms == 0 || ms > INTERVALO_MAX) {
+    return CONSOLE_ARG_INVALIDO;
+  }
+  return agenda.mudarPeriodo(id, ms * 1000UL) ? CONSOLE_OK : CONSOLE_ARG_INVALIDO;
+}
+
+uint8_t cmdSensores(uint8_t argc, char* argv[]) {
+  registrarEstado();
+  return CONSOLE_OK;
+}
+
+uint8_t cmdStats(uint8_t argc, char* argv[]) {
+  emitirTelemetria();
+  return CONSOLE_OK;
+}
+
+const char nomeLimpar[] PROGMEM = "limpar";
+const char nomeA[] PROGMEM = "a";
+const char nomeDocar[] PROGMEM = "docar";
+const char nomeB[] PROGMEM = "b";
+const char nomeEstado[] PROGMEM = "estado";
+const char nomeIntervalo[] PROGMEM = "intervalo";
+const char nomeSensores[] PROGMEM = "sensores";
+const char nomeStats[] PROGMEM = "stats";
+
+const Comando comandos[] PROGMEM = {
+  { nomeLimpar,    0, cmdLimpar },
+  { nomeA,         0, cmdLimpar },
+  { nomeDocar,     0, cmdDocar },
+  { nomeB,         0, cmdDocar },
+  { nomeEstado,    1, cmdEstado },
+  { nomeIntervalo, 2, cmdIntervalo },
+  { nomeSensores,  0, cmdSensores },
+  { nomeStats,     0, cmdStats },
+};
+
+Console<sizeof(comandos) / sizeof(comandos[0])> console(comandos);
 
-  if (millis() - timerPrint >= INTERVALO_PRINT) {
-    int distBit0 = digitalRead(DIST_PIN0);
-    int distBit1 = digitalRead(DIST_PIN1);
-    Serial.print(distBit0);
-    Serial.print(" ");
-    Serial.println(distBit1);
-    int estadoDist = (distBit1 << 1) | distBit0;
-
-    int estadoLuz = digitalRead(LUZ_PIN);
-    int estadoUmid = digitalRead(UMID_PIN);
-
-    Serial.println("---------- STATUS ESP32 ----------");
-    Serial.print("Estado do robô: ");
-    if (estadoAtual == IDLE) Serial.println("IDLE");
-    else if (estadoAtual == CLEAN) Serial.println("CLEAN");
-    else if (estadoAtual == DOCK) Serial.println("DOCK");
-    else if (estadoAtual == CHRG) Serial.println("CHARGING");
-
-    Serial.print("Distância: ");
-    if (estadoDist == 0) Serial.println("Sem obstáculo");
-    else if (estadoDist == 1) Serial.println("Obstáculo longe");
-    else if (estadoDist == 2) Serial.println("Obstáculo meia distância");
-    else Serial.println("Obstáculo perto");
-
-    Serial.print("Luminosidade: ");
-    if (estadoLuz == 0) Serial.println("Sem obstáculo acima");
-    else Serial.println("Obstáculo acima");
-
-    Serial.print("Umidade: ");
-    if (estadoUmid == 0) Serial.println("Aceitável");
-    else Serial.println("Não aceitável");
-
-    Serial.println("----------------------------------");
-    timerPrint = millis();
+void responder(uint8_t resultado) {
+  RegistroResposta r;
+  memset(&r, 0, sizeof(r));
+  r.resultado = resultado;
+  strncpy(r.comando, console.nome(), TLM_NOME_TAREFA);
+  telemetria.registrar(TLM_RESPOSTA, &r, sizeof(r));
+}
+
+// Bloqueia a tarefa do loop() até o próximo prazo ou até um callback de
+// recepção (Serial2 ou console) avisar; nesse meio tempo o FreeRTOS roda a tarefa ociosa
+void dormir(uint32_t espera) {
+  TickType_t ticks = pdMS_TO_TICKS(espera / 1000);
+  if (ticks == 0) {
+    return;
   }
+  unsigned long inicio = micros();
+  ulTaskNotifyTake(pdTRUE, ticks);
+  tempoDormindo += micros() - inicio;
+}
+
+void setup() {
+  Serial.setTxBufferSize(TELEMETRIA_BUFFER);   // TX por interrupção; write() não espera
+  Serial.begin(115200);
+  led1.iniciar(LOW);
+  led2.iniciar(LOW);
+  Serial2.begin(PROTO_BAUD, SERIAL_8N1, ENLACE_RX_PIN, ENLACE_TX_PIN);
+  Serial2.onReceive(aoReceber);
+  Serial.onReceive(acordarLoop);
+
+  timerEstado = millis();
+  inicioPeriodo = micros();
+  robo.iniciar(IDLE);
+
+  tarefaLoop = xTaskGetCurrentTaskHandle();
+  agenda.periodica(PSTR("led1"), piscarLED1, INTERVALO_LED1 * 1000UL);
+  agenda.periodica(PSTR("led2"), piscarLED2, INTERVALO_LED2 * 1000UL);
+  agenda.periodica(PSTR("estado"), atualizarEstado, INTERVALO_BATERIA * 1000UL);
+  agenda.periodica(PSTR("enlace"), enviarEstado, ESTADO_INTERVALO * 1000UL);
+  agenda.periodica(PSTR("status"), emitirTelemetria, INTERVALO_PRINT * 1000UL);
+  tarefaTempo = agenda.unica(PSTR("tempo"), fimDoTempo);
+
+  // Texto só na partida; depois a serial leva telemetria binária
+  Serial.println(F("Roomba Inicializado! (telemetria: tools/telemetria.py)"));
+  Serial.println(F("Comandos: limpar (a), docar (b), estado <nome>, intervalo <tarefa> <ms>, sensores, stats"));
+}
+
+void loop() {
+  uint8_t resultado = console.ler(Serial);
+  if (resultado != CONSOLE_NADA) responder(resultado);
+
+  processarSensores();
+  uint32_t espera = agenda.executar();
+  telemetria.drenar(Serial);
+  voltasLoop++;
+
+  dormir(espera);
 }
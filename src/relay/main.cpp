@@ -0,0 +1,282 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebServer.h>
+#include <HTTPClient.h>
+#include <WebSocketsClient.h>
+#include <WebSocketsServer.h>
+
+// Relay de espectadores do agario: entra na rede do jogo como um único
+// cliente WebSocket (sem "join") e repete cada frame recebido para os
+// espectadores conectados na rede dele. O servidor do jogo paga um envio
+// por relay, não um por espectador.
+
+// Rede do jogo (o relay é estação nela)
+const char* game_ssid = "Agario_ESP32";
+const char* game_host = "192.168.4.1";
+
+// Rede dos espectadores (outra sub-rede, para não colidir com a do jogo)
+const char* ap_ssid = "Agario_Espectador";
+
+#define GAME_WS_PORT 81
+#define RELAY_DELAY_MS 1000        // atraso fixo dos espectadores
+#define RELAY_PLAYERS_MS 200       // no máximo um snapshot de jogadores por intervalo
+#define RELAY_QUEUE_FRAMES 48
+#define RELAY_QUEUE_BYTES (64 * 1024)
+#define PAGE_RETRY_MS 5000
+#define FRAME_REPLACEABLE 0x80     // bit no tipo dos binários do servidor (snapshot de jogadores)
+#define STATS_INTERVAL 10000
+
+WebServer server(80);
+WebSocketsServer viewers = WebSocketsServer(81);
+WebSocketsClient game;
+
+// Página do jogo, baixada uma vez do servidor
+String page;
+unsigned long lastPageTry = 0;
+
+// Frames esperando o atraso, todos num slab circular fixo: saem na ordem
+// em que entram, então cada um ocupa o espaço logo depois do anterior e
+// volta ao início do slab quando não cabe no fim. Nada de malloc/free por
+// frame. Cada frame reserva WEBSOCKETS_MAX_HEADER_SIZE bytes no início
+// para o cabeçalho ser escrito no lugar no broadcast.
+struct QueuedFrame {
+  size_t offset;       // início no slab (cabeçalho reservado)
+  size_t len;
+  unsigned long receivedAt;
+  bool binary;
+};
+
+uint8_t queueSlab[RELAY_QUEUE_BYTES];
+size_t slabTail = 0;   // onde o próximo frame começa
+QueuedFrame queue[RELAY_QUEUE_FRAMES];
+int queueHead = 0;
+int queueCount = 0;
+size_t queueBytes = 0;
+unsigned long lastPlayersFrame = 0;
+
+struct RelayStats {
+  uint32_t framesIn;
+  uint32_t framesOut;
+  uint32_t skipped;    // snapshots de jogadores acima da taxa
+  uint32_t dropped;    // fila cheia
+  uint32_t bytesIn;
+};
+
+RelayStats stats = {0, 0, 0, 0, 0};
+
+void dropOldest() {
+  queueBytes -= queue[queueHead].len;
+  queueHead = (queueHead + 1) % RELAY_QUEUE_FRAMES;
+  queueCount--;
+  if (queueCount == 0) {
+    slabTail = 0;
+  }
+}
+
+// Espaço contíguo para size bytes depois do último frame, sem passar do
+// mais antigo; false se não couber sem descartar
+bool slabReserve(size_t size, size_t* offset) {
+  if (queueCount == 0) {
+    *offset = 0;
+    return size <= RELAY_QUEUE_BYTES;
+  }
+  size_t head = queue[queueHead].offset;
+  if (slabTail > head) {
+    // Ocupado [head, slabTail): livre no fim ou antes de head
+    if (RELAY_QUEUE_BYTES - slabTail >= size) {
+      *offset = slabTail;
+      return true;
+    }
+    if (head >= size) {
+      *offset = 0;
+      return true;
+    }
+    return false;
+  }
+  // Já deu a volta: livre só [slabTail, head)
+  if (head - slabTail >= size) {
+    *offset = slabTail;
+    return true;
+  }
+  return false;
+}
+
+// Snapshots de jogadores podem ser descartados: o próximo substitui o
+// anterior e o cliente interpola. Em texto pelo começo do JSON; acima de
+// 1 KB o servidor manda comprimido e marca o tipo com FRAME_REPLACEABLE.
+bool isPlayersFrame(const uint8_t* payload, size_t length, bool binary) {
+  if (binary) {
+    return length > 0 && (payload[0] & FRAME_REPLACEABLE);
+  }
+  return length > 17 && memcmp(payload, "{\"type\":\"players\"", 17) == 0;
+}
+
+void enqueueFrame(uint8_t* payload, size_t length, bool binary) {
+  stats.framesIn++;
+  stats.bytesIn += length;
+
+  // Pellets e eventos passam sempre
+  if (isPlayersFrame(payload, length, binary)) {
+    if (millis() - lastPlayersFrame < RELAY_PLAYERS_MS) {
+      stats.skipped++;
+      return;
+    }
+    lastPlayersFrame = millis();
+  }
+
+  size_t size = WEBSOCKETS_MAX_HEADER_SIZE + length;
+  if (size > RELAY_QUEUE_BYTES) {
+    stats.dropped++;
+    return;
+  }
+
+  size_t offset;
+  while (queueCount == RELAY_QUEUE_FRAMES || !slabReserve(size, &offset)) {
+    dropOldest();
+    stats.dropped++;
+  }
+  memcpy(queueSlab + offset + WEBSOCKETS_MAX_HEADER_SIZE, payload, length);
+  slabTail = offset + size;
+
+  QueuedFrame& frame = queue[(queueHead + queueCount) % RELAY_QUEUE_FRAMES];
+  frame.offset = offset;
+  frame.len = length;
+  frame.receivedAt = millis();
+  frame.binary = binary;
+  queueCount++;
+  queueBytes += length;
+}
+
+// Repassar aos espectadores os frames que já cumpriram o atraso
+void flushQueue() {
+  while (queueCount > 0 && millis() - queue[queueHead].receivedAt >= RELAY_DELAY_MS) {
+    QueuedFrame& frame = queue[queueHead];
+    uint8_t* buf = queueSlab + frame.offset;
+    if (viewers.connectedClients() > 0) {
+      if (frame.binary) {
+        viewers.broadcastBIN(buf, frame.len, true);
+      } else {
+        viewers.broadcastTXT(buf, frame.len, true);
+      }
+      stats.framesOut++;
+    }
+    dropOldest();
+  }
+}
+
+void gameEvent(WStype_t type, uint8_t * payload, size_t length) {
+  switch(type) {
+    case WStype_CONNECTED:
+      Serial.println("Conectado ao servidor do jogo");
+      break;
+
+    case WStype_DISCONNECTED:
+      Serial.println("Desconectado do servidor do jogo");
+      break;
+
+    case WStype_TEXT:
+      enqueueFrame(payload, length, false);
+      break;
+
+    case WStype_BIN:
+      enqueueFrame(payload, length, true);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// Espectadores só recebem; o que eles mandarem é ignorado
+void viewerEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
+  if (type == WStype_CONNECTED) {
+    Serial.printf("[%u] Espectador conectado\n", num);
+  } else if (type == WStype_DISCONNECTED) {
+    Serial.printf("[%u] Espectador saiu\n", num);
+  }
+}
+
+// Baixar a página do servidor do jogo (a mesma do jogador, em ?spectate)
+void fetchPage() {
+  if (page.length() > 0 || WiFi.status() != WL_CONNECTED ||
+      millis() - lastPageTry < PAGE_RETRY_MS) {
+    return;
+  }
+  lastPageTry = millis();
+
+  HTTPClient http;
+  http.begin(String("http://") + game_host + "/");
+  int code = http.GET();
+  if (code == 200) {
+    page = http.getString();
+    Serial.printf("Página do jogo em cache: %u bytes\n", (unsigned)page.length());
+  } else {
+    Serial.printf("Erro ao baixar a página: %d\n", code);
+  }
+  http.end();
+}
+
+void handleRoot() {
+  if (!server.hasArg("spectate")) {
+    server.sendHeader("Location", "/?spectate");
+    server.send(302, "text/plain", "");
+    return;
+  }
+  if (page.length() == 0) {
+    server.send(503, "text/plain", "Aguardando o servidor do jogo\n");
+    return;
+  }
+  server.send(200, "text/html", page);
+}
+
+void printStats() {
+  static unsigned long lastStats = 0;
+
+  if (millis() - lastStats < STATS_INTERVAL) {
+    return;
+  }
+  lastStats = millis();
+
+  Serial.printf("Relay: %d espectadores, %u frames in (%u bytes), %u out, %u acima da taxa, %u descartados, fila %d (%u bytes)\n",
+                viewers.connectedClients(), (unsigned)stats.framesIn, (unsigned)stats.bytesIn,
+                (unsigned)stats.framesOut, (unsigned)stats.skipped, (unsigned)stats.dropped,
+                queueCount, (unsigned)queueBytes);
+  memset(&stats, 0, sizeof(stats));
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // Estação na rede do jogo e Access Point próprio ao mesmo tempo
+  WiFi.mode(WIFI_AP_STA);
+  WiFi.begin(game_ssid);
+
+  IPAddress local_ip(192, 168, 5, 1);
+  IPAddress gateway(192, 168, 5, 1);
+  IPAddress subnet(255, 255, 255, 0);
+  WiFi.softAPConfig(local_ip, gateway, subnet);
+  WiFi.softAP(ap_ssid);
+
+  Serial.print("Espectadores: conecte-se a ");
+  Serial.print(ap_ssid);
+  Serial.println(" e acesse http://192.168.5.1");
+
+  server.on("/", handleRoot);
+  server.begin();
+
+  viewers.begin();
+  viewers.onEvent(viewerEvent);
+
+  game.begin(game_host, GAME_WS_PORT, "/");
+  game.onEvent(gameEvent);
+  game.setReconnectInterval(2000);
+}
+
+void loop() {
+  server.handleClient();
+  game.loop();
+  viewers.loop();
+  flushQueue();
+  fetchPage();
+  printStats();
+}
@@ -0,0 +1,95 @@
+#include "Arduino.h"
+#include "pino.h"
+#include "filtros.h"
+
+// Bancada no Leonardo, contada no Timer1 sem prescaler com as interrupções
+// desligadas (o laço vazio é descontado):
+//   - ciclos por escrita no LED TX com digitalWrite(), Pino<> e SaidaSombra
+//   - ciclos por amostra dos filtros do sketch do Arduino, e de uma média
+//     exponencial em float para comparar
+// Resultado na serial a cada 2 s; o LED RX pisca entre as medidas.
+// O core USB também mexe nos LEDs RX/TX a cada transmissão: a serial é
+// esvaziada antes das contagens, e dentro delas as interrupções estão
+// desligadas, então o tráfego não entra nos ciclos medidos.
+
+#define REPETICOES 256      // 256 x ~80 ciclos ainda cabe no Timer1
+#define AMOSTRAS 64         // filtros: até ~1000 ciclos por amostra
+
+volatile int16_t saida;
+
+typedef Pino<LED_BUILTIN_TX, PINO_SAIDA> LedTx;
+SaidaSombra<LED_BUILTIN_RX> ledRx;
+
+// Entrada com ruído para os filtros, a mesma no laço vazio
+inline int16_t amostra(uint16_t k) {
+    return 300 + ((k * 37) & 0x3F);
+}
+
+template <uint16_t N, typename Corpo>
+uint16_t contarCiclos(Corpo corpo) {
+    noInterrupts();
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);
+    TCNT1 = 0;
+    for (uint16_t k = 0; k < N; k++) corpo(k);
+    uint16_t total = TCNT1;
+    TCCR1B = 0;
+    interrupts();
+    return total;
+}
+
+void mostrar(const __FlashStringHelper* nome, uint16_t total, uint16_t vazio, uint16_t n) {
+    Serial.print(nome);
+    Serial.print((float)(total - vazio) / n);
+    Serial.println(F(" ciclos"));
+}
+
+void setup(){
+    Serial.begin(115200);
+    LedTx::iniciar();
+    ledRx.iniciar(LOW);
+}
+
+
+void loop(){
+    Serial.flush();
+    uint16_t vazio = contarCiclos<REPETICOES>([](uint16_t) { asm volatile(""); });
+    uint16_t arduino = contarCiclos<REPETICOES>([](uint16_t k) { digitalWrite(LED_BUILTIN_TX, k & 1); });
+    uint16_t escrever = contarCiclos<REPETICOES>([](uint16_t k) { LedTx::escrever(k & 1); });
+    uint16_t alternar = contarCiclos<REPETICOES>([](uint16_t) { LedTx::alternar(); });
+    uint16_t sombra = contarCiclos<REPETICOES>([](uint16_t) { ledRx.escrever(HIGH); });
+
+    Serial.println(F("---------- escrita no pino ----------"));
+    mostrar(F("digitalWrite:         "), arduino, vazio, REPETICOES);
+    mostrar(F("Pino::escrever:       "), escrever, vazio, REPETICOES);
+    mostrar(F("Pino::alternar:       "), alternar, vazio, REPETICOES);
+    mostrar(F("SaidaSombra sem troca:"), sombra, vazio, REPETICOES);
+    Serial.print(F("alternâncias/s com Pino: "));
+    Serial.println((float)F_CPU * REPETICOES / max(alternar - vazio, 1), 0);
+
+    static Mediana<5> mediana;
+    static MediaExp<3> media;
+    static Cadeia<Mediana<3>, MediaExp<3> > cadeia;
+    static Faixas<2, 10, 20, 50> faixas;
+    static float mediaFloat = 0;
+
+    uint16_t semFiltro = contarCiclos<AMOSTRAS>([](uint16_t k) { saida = amostra(k); });
+    uint16_t cMediana = contarCiclos<AMOSTRAS>([](uint16_t k) { saida = mediana.filtrar(amostra(k)); });
+    uint16_t cMedia = contarCiclos<AMOSTRAS>([](uint16_t k) { saida = media.filtrar(amostra(k)); });
+    uint16_t cCadeia = contarCiclos<AMOSTRAS>([](uint16_t k) { saida = cadeia.filtrar(amostra(k)); });
+    uint16_t cFaixas = contarCiclos<AMOSTRAS>([](uint16_t k) { saida = faixas.filtrar(amostra(k) - 290); });
+    uint16_t cFloat = contarCiclos<AMOSTRAS>([](uint16_t k) {
+        mediaFloat += 0.125f * (amostra(k) - mediaFloat);
+        saida = mediaFloat;
+    });
+
+    Serial.println(F("---------- filtros, por amostra ----------"));
+    mostrar(F("Mediana<5>:           "), cMediana, semFiltro, AMOSTRAS);
+    mostrar(F("MediaExp<3>:          "), cMedia, semFiltro, AMOSTRAS);
+    mostrar(F("Mediana<3> + EMA 1/8: "), cCadeia, semFiltro, AMOSTRAS);
+    mostrar(F("Faixas (3 limites):   "), cFaixas, semFiltro, AMOSTRAS);
+    mostrar(F("EMA 1/8 em float:     "), cFloat, semFiltro, AMOSTRAS);
+
+    ledRx.alternar();
+    delay(2000);
+}
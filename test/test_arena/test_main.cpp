@@ -0,0 +1,234 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ArduinoJson.h>
+#include "arena.h"
+#include "messages.h"
+
+// Arena por tick (src/agario/arena.h) no host: o alocador sozinho e um
+// soak com os mesmos documentos do servidor, tick a tick, medindo o pico.
+//
+// Os slots do ArduinoJson têm o tamanho de ponteiro, então com 64 bits os
+// documentos ocupam perto do dobro do ESP32; a arena do soak cresce junto.
+
+#define TICK_ARENA_SIZE 8192
+#define SOAK_ARENA_SIZE (TICK_ARENA_SIZE * sizeof(void*) / 4)
+#define MAX_PLAYERS 10
+#define MAX_GHOSTS (2 * MAX_PLAYERS)
+#define SOAK_TICKS 72000      // 1 h a 20 ticks/s
+
+static uint8_t buffer[SOAK_ARENA_SIZE];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_bump_and_release() {
+  TickArena arena(buffer, 256);
+  void* a = arena.allocate(10);
+  void* b = arena.allocate(20);
+  TEST_ASSERT_NOT_NULL(a);
+  TEST_ASSERT_NOT_NULL(b);
+  TEST_ASSERT_TRUE((uint8_t*)b > (uint8_t*)a);
+  TEST_ASSERT_EQUAL(0, ((uintptr_t)b - (uintptr_t)buffer) % 8);
+
+  // Só o último volta de verdade
+  size_t top = arena.used();
+  arena.deallocate(a);
+  TEST_ASSERT_EQUAL(top, arena.used());
+  arena.deallocate(b);
+  TEST_ASSERT_TRUE(arena.used() < top);
+
+  size_t mark = arena.mark();
+  {
+    ArenaScope scope(arena);
+    arena.allocate(100);
+    TEST_ASSERT_TRUE(arena.used() > mark);
+  }
+  TEST_ASSERT_EQUAL(mark, arena.used());
+  TEST_ASSERT_TRUE(arena.highWater() >= mark + 100);
+}
+
+void test_reallocate() {
+  TickArena arena(buffer, 256);
+  char* a = (char*)arena.allocate(8);
+  memcpy(a, "1234567", 8);
+
+  // O último cresce no lugar
+  TEST_ASSERT_TRUE(arena.reallocate(a, 40) == a);
+  char* b = (char*)arena.allocate(8);
+
+  // Outro bloco: encolhe no lugar, cresce copiando
+  TEST_ASSERT_TRUE(arena.reallocate(a, 16) == a);
+  char* moved = (char*)arena.reallocate(a, 64);
+  TEST_ASSERT_NOT_NULL(moved);
+  TEST_ASSERT_TRUE(moved > b);
+  TEST_ASSERT_EQUAL_STRING("1234567", moved);
+}
+
+void test_failure_counted() {
+  TickArena arena(buffer, 64);
+  TEST_ASSERT_NULL(arena.allocate(100));
+  void* a = arena.allocate(16);
+  TEST_ASSERT_NULL(arena.reallocate(a, 100));
+  TEST_ASSERT_EQUAL_UINT32(2, arena.failures());
+  arena.reset();
+  TEST_ASSERT_EQUAL(0, arena.used());
+}
+
+// Estado dos jogadores como no servidor (strings em char[], copiadas)
+struct SoakPlayer {
+  char id[16];
+  char name[24];
+  char fill[24];
+  char stroke[24];
+  float x, y, r;
+  uint32_t ack;
+};
+
+static SoakPlayer players[MAX_PLAYERS + MAX_GHOSTS];
+static JsonDocument inputFilter;
+static char out[8192];
+
+static uint32_t rng = 0x9E3779B9u;
+static uint32_t next() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+// handleMessage(): parse filtrado na arena; o join ainda monta o init e o
+// ranking com a mensagem viva, o pior aninhamento do servidor
+static void handleMessage(TickArena& arena, const char* text, bool join) {
+  ArenaScope scope(arena);
+  JsonDocument doc(&arena);
+  TEST_ASSERT_FALSE(deserializeJson(doc, text, strlen(text), DeserializationOption::Filter(inputFilter)));
+  if (!join) {
+    float mx = doc["mx"];
+    TEST_ASSERT_TRUE(mx >= -1 && mx <= 1);
+    return;
+  }
+
+  JsonDocument init(&arena);
+  init["type"] = "init";
+  init["playerId"] = players[0].id;
+  init["x"] = players[0].x;
+  init["y"] = players[0].y;
+  init["r"] = players[0].r;
+  init["resume"] = next();
+  init["resumed"] = false;
+  serializeJson(init, out, sizeof(out));
+
+  ArenaScope inner(arena);
+  JsonDocument top(&arena);
+  top["type"] = "leaderboard";
+  JsonArray list = top["top"].to<JsonArray>();
+  for (int k = 0; k < 5; k++) {
+    JsonObject entry = list.add<JsonObject>();
+    entry["id"] = players[k].id;
+    entry["name"] = players[k].name;
+    entry["r"] = (int)players[k].r;
+  }
+  serializeJson(top, out, sizeof(out));
+}
+
+// broadcastGameState(): todos os jogadores e espelhos num documento
+static void broadcastPlayers(TickArena& arena, int count) {
+  ArenaScope scope(arena);
+  JsonDocument doc(&arena);
+  doc["type"] = "players";
+  JsonObject all = doc["players"].to<JsonObject>();
+  for (int i = 0; i < count; i++) {
+    JsonObject p = all[players[i].id].to<JsonObject>();
+    p["x"] = players[i].x;
+    p["y"] = players[i].y;
+    p["r"] = players[i].r;
+    p["ack"] = players[i].ack;
+    p["name"] = players[i].name;
+    p["fillColor"] = players[i].fill;
+    p["strokeColor"] = players[i].stroke;
+  }
+  TEST_ASSERT_FALSE(doc.overflowed());
+  TEST_ASSERT_TRUE(measureJson(doc) < sizeof(out));
+  serializeJson(doc, out, sizeof(out));
+}
+
+// Uma hora de jogo: a cada tick a arena zera (gameTick), chegam 0 a 10
+// inputs, às vezes um join, e a cada 2 ticks vai o snapshot de jogadores.
+// Cada escopo começa com a arena vazia, então clearStats() antes dele dá
+// o pico daquele tipo de documento.
+void test_soak_high_water() {
+  buildInputFilter(inputFilter);
+
+  for (int i = 0; i < MAX_PLAYERS + MAX_GHOSTS; i++) {
+    snprintf(players[i].id, sizeof(players[i].id), i < 4 ? "%d" : "bot1.%d", 1000 + i * 37);
+    snprintf(players[i].name, sizeof(players[i].name), "Jogador_com_nome_%d", i);
+    snprintf(players[i].fill, sizeof(players[i].fill), "rgb(%d,130,7)", 100 + i);
+    snprintf(players[i].stroke, sizeof(players[i].stroke), "rgb(%d,111,6)", 85 + i);
+  }
+
+  TickArena arena(buffer, SOAK_ARENA_SIZE);
+  size_t peakInput = 0, peakJoin = 0, peakPlayers = 0;
+  char text[4096];
+
+  for (uint32_t tick = 0; tick < SOAK_TICKS; tick++) {
+    arena.reset();
+    for (int i = 0; i < MAX_PLAYERS + MAX_GHOSTS; i++) {
+      players[i].x = (next() % 500000) / 100.0f;
+      players[i].y = (next() % 500000) / 100.0f;
+      players[i].r = 20 + (next() % 8000) / 100.0f;
+      players[i].ack = tick;
+    }
+
+    int inputs = next() % 11;
+    for (int k = 0; k < inputs; k++) {
+      snprintf(text, sizeof(text),
+               "{\"type\":\"input\",\"playerId\":\"%s\",\"seq\":%u,\"mx\":%.4f,\"my\":%.4f,\"dt\":0.016,"
+               "\"extra\":{\"lixo\":[1,2,3,4,5,6,7,8]}}",
+               players[k].id, (unsigned)tick, (next() % 2000) / 1000.0 - 1, (next() % 2000) / 1000.0 - 1);
+      arena.clearStats();
+      handleMessage(arena, text, false);
+      if (arena.highWater() > peakInput) peakInput = arena.highWater();
+    }
+
+    if (next() % 200 == 0) {
+      snprintf(text, sizeof(text),
+               "{\"type\":\"join\",\"playerId\":\"%u\",\"name\":\"%s\",\"fillColor\":\"%s\",\"strokeColor\":\"%s\"}",
+               (unsigned)(next() % 10000), players[1].name, players[1].fill, players[1].stroke);
+      arena.clearStats();
+      handleMessage(arena, text, true);
+      if (arena.highWater() > peakJoin) peakJoin = arena.highWater();
+    }
+
+    if (tick % 2 == 0) {
+      // Espelhos aparecem e somem com o vizinho
+      int count = MAX_PLAYERS + (tick / 2000 % 2 ? MAX_GHOSTS : (int)(next() % 4));
+      arena.clearStats();
+      broadcastPlayers(arena, count);
+      if (arena.highWater() > peakPlayers) peakPlayers = arena.highWater();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, arena.failures());
+  }
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "arena (%u bytes, %u-bit): pico input %u, join %u, players %u em %u ticks",
+           (unsigned)SOAK_ARENA_SIZE, (unsigned)(8 * sizeof(void*)), (unsigned)peakInput,
+           (unsigned)peakJoin, (unsigned)peakPlayers, (unsigned)SOAK_TICKS);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(peakPlayers < SOAK_ARENA_SIZE);
+
+  // Todo documento do servidor aloca na arena; pico zero quer dizer que o
+  // ArduinoJson do build não é o de verdade, e os números acima não valem
+  TEST_ASSERT_TRUE(peakInput > 0);
+  TEST_ASSERT_TRUE(peakJoin > 0);
+  TEST_ASSERT_TRUE(peakPlayers > 0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bump_and_release);
+  RUN_TEST(test_reallocate);
+  RUN_TEST(test_failure_counted);
+  RUN_TEST(test_soak_high_water);
+  return UNITY_END();
+}
@@ -0,0 +1,130 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+// Slots para 64 bots mais folga; no ESP32 MAX_PLAYERS continua 10
+#define MAX_PLAYERS 72
+#include "world.h"
+
+// Bots do agario (src/agario/world.h) no host:
+//   - bot atacando não passa pela compensação de latência (vê a vítima
+//     onde ela está, não onde estava na tela de um humano)
+//   - tempo do tick com 0, 16 e 64 bots, no orçamento de tempo do servidor
+
+#define BENCH_TICKS 4000
+
+static unsigned long gameClock = 0;
+static unsigned long clockNow() { return gameClock; }
+static unsigned long wallMicros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static World world;
+static int eatenCount;
+static int victim;
+
+static void onPlayerEaten(int, const char*, const char*) {
+  eatenCount++;
+}
+
+static void resetWorld(int bots) {
+  world.hooks.clock = clockNow;
+  world.hooks.micros = wallMicros;
+  world.hooks.playerEaten = onPlayerEaten;
+  world.botPopulation = bots;
+  gameClock = 0;
+  eatenCount = 0;
+  world.reset(42);
+}
+
+// Vítima parada em (1000, 1000) por 10 ticks e então movida 300 px; o
+// histórico ainda a mostra no ponto antigo. Atacante de raio 100 no ponto
+// antigo: com o RTT 0 e INTERP_DELAY_MS 200, um humano volta 4 ticks.
+static int setupAttack(bool attackerIsBot) {
+  resetWorld(0);
+  victim = world.join(1, "vitima", "Vitima", "rgb(7,191,255)", "rgb(6,162,217)");
+  world.spawnPlayer(victim);
+  world.players[victim].x = 1000;
+  world.players[victim].y = 1000;
+  world.players[victim].r = 20;
+  for (int t = 0; t < 10; t++) world.tick(0);
+  world.players[victim].x = 1300;
+
+  int attacker = world.join(2, "atacante", "Atacante", "rgb(255,14,7)", "rgb(217,12,6)");
+  world.spawnPlayer(attacker);
+  world.players[attacker].x = 1000;
+  world.players[attacker].y = 1000;
+  world.players[attacker].r = 100;
+  world.players[attacker].rttMs = 0;
+  world.players[attacker].isBot = attackerIsBot;
+  return attacker;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Humano: come a vítima na posição rebobinada (a que ele via na tela)
+void test_human_attacker_rewinds() {
+  int attacker = setupAttack(false);
+  world.applyInput(attacker, 1, 0, 0, 0);
+  TEST_ASSERT_EQUAL(1, eatenCount);
+}
+
+// Bot: sem tela nem atraso, a vítima a 300 px (fora do raio) escapa
+void test_bot_attacker_does_not_rewind() {
+  int attacker = setupAttack(true);
+  world.movePlayer(attacker, 0, 0, 0);
+  TEST_ASSERT_EQUAL(0, eatenCount);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1300, world.players[victim].x);
+
+  // A vítima dentro do raio agora: o bot come
+  world.players[victim].x = 1050;
+  world.movePlayer(attacker, 0, 0, 0);
+  TEST_ASSERT_EQUAL(1, eatenCount);
+}
+
+// Tick com 'bots' bots: primeiro a população completa (um bot por tick),
+// depois BENCH_TICKS ticks de 50 ms no relógio do jogo
+static void bench(int bots) {
+  resetWorld(bots);
+  for (int t = 0; t < bots + 10; t++) {
+    gameClock += TICK_MS;
+    world.tick(-1);
+  }
+  TEST_ASSERT_EQUAL(bots, world.playerCount);
+
+  std::vector<uint32_t> micros;
+  uint32_t decisions = 0;
+  for (int t = 0; t < BENCH_TICKS; t++) {
+    gameClock += TICK_MS;
+    unsigned long start = wallMicros();
+    decisions += world.tick(-1);
+    micros.push_back(wallMicros() - start);
+  }
+  std::sort(micros.begin(), micros.end());
+
+  char msg[200];
+  snprintf(msg, sizeof(msg),
+           "%2d bots: tick p50 %u us, p90 %u us, p99 %u us, max %u us; %.2f decisões/tick (orçamento %u us)",
+           bots, (unsigned)micros[BENCH_TICKS / 2], (unsigned)micros[BENCH_TICKS * 9 / 10],
+           (unsigned)micros[BENCH_TICKS * 99 / 100], (unsigned)micros.back(),
+           (double)decisions / BENCH_TICKS, (unsigned)BOT_BUDGET_US);
+  TEST_MESSAGE(msg);
+}
+
+void test_tick_with_bots() {
+  bench(0);
+  bench(16);
+  bench(64);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_human_attacker_rewinds);
+  RUN_TEST(test_bot_attacker_does_not_rewind);
+  RUN_TEST(test_tick_with_bots);
+  return UNITY_END();
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Gera tracos.h: leituras com ruído dos sensores do Arduino.
+
+Degraus perto dos limites de src/arduino/main.cpp com ruído sintético:
+sonar com ±3 cm e 5% de pings sem eco (0), LDR com ±8 contagens e
+umidade do DHT11 alternando entre 69,5% e 70,8%. Semente fixa, então
+rodar de novo dá o mesmo arquivo.
+
+    python3 test/test_filtros/gerar_tracos.py > test/test_filtros/tracos.h
+"""
+
+import random
+
+random.seed(7)
+
+
+def sonar():
+    saida = []
+    for k in range(400):
+        base = 60 if k < 130 else 19 if k < 270 else 8
+        d = base + random.randint(-3, 3)
+        saida.append(0 if random.random() < 0.05 else d)
+    return saida
+
+
+def ldr():
+    return [(62 if k < 300 else 20) + random.randint(-8, 8) for k in range(400)]
+
+
+def umidade():
+    # décimos de %: 65%, depois 69,5..70,8 em volta do limite e um degrau
+    # de verdade para 75%
+    saida = [650 + random.randint(-2, 2) for k in range(10)]
+    saida += [695 if k % 2 else 708 for k in range(40)]
+    return saida + [750 + random.randint(-2, 2) for k in range(20)]
+
+
+def vetor(nome, tipo, valores):
+    linhas = []
+    for k in range(0, len(valores), 16):
+        linhas.append("  " + ", ".join(str(v) for v in valores[k:k + 16]) + ",")
+    return "const %s %s[] = {\n%s\n};\n" % (tipo, nome, "\n".join(linhas))
+
+
+print("// Traços sintéticos gerados por gerar_tracos.py; não editar à mão")
+print("#ifndef TRACOS_H\n#define TRACOS_H\n\n#include <stdint.h>\n")
+print("// cm, 0 = ping sem eco; degraus 60 -> 19 (amostra 130) -> 8 (amostra 270)")
+print(vetor("TRACO_SONAR", "uint16_t", sonar()))
+print("// analogRead(); 62 -> 20 na amostra 300, limite em 60")
+print(vetor("TRACO_LDR", "int16_t", ldr()))
+print("// décimos de %; 65%, oscila em volta de 70% (amostras 10-49) e sobe para 75%")
+print(vetor("TRACO_UMIDADE", "int16_t", umidade()))
+print("#endif")
@@ -0,0 +1,168 @@
+#include <unity.h>
+#include "filtros.h"
+#include "tracos.h"
+
+// Filtros do Arduino (include/filtros.h) no host: valores calculados à mão
+// e os traços de tracos.h com as mesmas cadeias de src/arduino/main.cpp
+
+#define TAMANHO(v) (sizeof(v) / sizeof(v[0]))
+
+// Índice da amostra e faixa depois dela, a cada troca
+struct Troca {
+  uint16_t amostra;
+  uint8_t faixa;
+};
+
+static void conferirTrocas(const Troca* esperadas, size_t n, const uint8_t* faixas, size_t amostras) {
+  size_t t = 0;
+  for (size_t k = 0; k < amostras; k++) {
+    if (k > 0 && faixas[k] == faixas[k - 1]) continue;
+    TEST_ASSERT_TRUE_MESSAGE(t < n, "troca a mais");
+    TEST_ASSERT_EQUAL_UINT(esperadas[t].amostra, k);
+    TEST_ASSERT_EQUAL_UINT8(esperadas[t].faixa, faixas[k]);
+    t++;
+  }
+  TEST_ASSERT_EQUAL_UINT(n, t);
+}
+
+static size_t contarTrocas(const uint8_t* faixas, size_t n) {
+  size_t trocas = 0;
+  for (size_t k = 1; k < n; k++) trocas += faixas[k] != faixas[k - 1];
+  return trocas;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_mediana() {
+  Mediana<5> m;
+  // Antes de encher: mediana do que tem (a menor das duas do meio)
+  TEST_ASSERT_EQUAL_INT16(5, m.filtrar(5));
+  TEST_ASSERT_EQUAL_INT16(5, m.filtrar(100));
+  TEST_ASSERT_EQUAL_INT16(7, m.filtrar(7));
+  TEST_ASSERT_EQUAL_INT16(6, m.filtrar(6));
+  TEST_ASSERT_EQUAL_INT16(7, m.filtrar(300));    // 5 6 7 100 300
+  TEST_ASSERT_EQUAL_INT16(7, m.filtrar(-4));     // 100 7 6 300 -4
+  TEST_ASSERT_EQUAL_INT16(7, m.filtrar(8));      // 7 6 300 -4 8
+  TEST_ASSERT_EQUAL_INT16(8, m.filtrar(9));      // 6 300 -4 8 9
+}
+
+// alfa 1/8: soma = 8y; y = soma >> 3
+void test_media_exponencial() {
+  MediaExp<3> e;
+  TEST_ASSERT_EQUAL_INT16(0, e.filtrar(0));      // soma 0
+  TEST_ASSERT_EQUAL_INT16(10, e.filtrar(80));    // 0 + 80 - 0 = 80
+  TEST_ASSERT_EQUAL_INT16(18, e.filtrar(80));    // 80 + 80 - 10 = 150
+  TEST_ASSERT_EQUAL_INT16(26, e.filtrar(80));    // 150 + 80 - 18 = 212
+
+  // Começa na primeira amostra e chega exatamente na entrada constante
+  MediaExp<3> f;
+  TEST_ASSERT_EQUAL_INT16(1000, f.filtrar(1000));
+  int16_t y = 0;
+  for (int k = 0; k < 200; k++) y = f.filtrar(-37);
+  TEST_ASSERT_EQUAL_INT16(-37, y);
+  for (int k = 0; k < 200; k++) y = f.filtrar(1023);
+  TEST_ASSERT_EQUAL_INT16(1023, y);
+}
+
+void test_cadeia_igual_aos_estagios() {
+  Cadeia<Mediana<3>, MediaExp<2> > cadeia;
+  Mediana<3> m;
+  MediaExp<2> e;
+  for (size_t k = 0; k < TAMANHO(TRACO_LDR); k++) {
+    TEST_ASSERT_EQUAL_INT16(e.filtrar(m.filtrar(TRACO_LDR[k])), cadeia.filtrar(TRACO_LDR[k]));
+  }
+}
+
+void test_faixas_histerese() {
+  Faixas<2, 10, 20, 50> f;
+  TEST_ASSERT_EQUAL_UINT8(3, f.filtrar(60));     // primeira amostra: sem margem
+  TEST_ASSERT_EQUAL_UINT8(3, f.filtrar(49));     // ainda acima de 50 - 2
+  TEST_ASSERT_EQUAL_UINT8(2, f.filtrar(48));
+  TEST_ASSERT_EQUAL_UINT8(2, f.filtrar(52));     // não passa de 50 + 2
+  TEST_ASSERT_EQUAL_UINT8(3, f.filtrar(53));
+  TEST_ASSERT_EQUAL_UINT8(0, f.filtrar(5));      // desce várias de uma vez
+  TEST_ASSERT_EQUAL_UINT8(0, f.filtrar(12));
+  TEST_ASSERT_EQUAL_UINT8(1, f.filtrar(13));
+  TEST_ASSERT_EQUAL_UINT8(1, f.filtrar(9));
+  TEST_ASSERT_EQUAL_UINT8(0, f.filtrar(8));      // em 10 - 2 já desce
+  TEST_ASSERT_EQUAL_UINT8(3, f.filtrar(400));    // sobe várias de uma vez
+  TEST_ASSERT_EQUAL_UINT8(3, f.nivel());
+
+  Faixas<0, 59> semMargem;
+  TEST_ASSERT_EQUAL_UINT8(0, semMargem.filtrar(59));
+  TEST_ASSERT_EQUAL_UINT8(1, semMargem.filtrar(60));
+  TEST_ASSERT_EQUAL_UINT8(0, semMargem.filtrar(59));
+}
+
+// Sonar como em lerSensores(): sem eco vira 400, Mediana<5>, faixas em cm
+void test_traco_sonar() {
+  const size_t n = TAMANHO(TRACO_SONAR);
+  uint8_t filtrado[n];
+  uint8_t cru[n];
+  Mediana<5> mediana;
+  Faixas<2, 10, 20, 50> faixas;
+  for (size_t k = 0; k < n; k++) {
+    int16_t cm = TRACO_SONAR[k] ? TRACO_SONAR[k] : 400;
+    filtrado[k] = 3 - faixas.filtrar(mediana.filtrar(cm));
+    cru[k] = (cm > 50) ? 0 : (cm > 20) ? 1 : (cm > 10) ? 2 : 3;
+  }
+
+  // Os degraus são nas amostras 130 e 270; a mediana passa por 22 cm
+  // numa amostra no caminho de 60 para 19
+  const Troca esperadas[] = { {0, 0}, {132, 1}, {133, 2}, {273, 3} };
+  conferirTrocas(esperadas, TAMANHO(esperadas), filtrado, n);
+  TEST_ASSERT_GREATER_THAN(80, contarTrocas(cru, n));
+}
+
+// LDR: Mediana<3> + EMA 1/8, obstáculo acima com a leitura em 59 ou menos
+void test_traco_ldr() {
+  const size_t n = TAMANHO(TRACO_LDR);
+  uint8_t filtrado[n];
+  uint8_t cru[n];
+  Cadeia<Mediana<3>, MediaExp<3> > filtro;
+  Faixas<5, 59> faixas;
+  for (size_t k = 0; k < n; k++) {
+    filtrado[k] = faixas.filtrar(filtro.filtrar(TRACO_LDR[k])) == 0;
+    cru[k] = TRACO_LDR[k] < 60;
+  }
+
+  const Troca esperadas[] = { {0, 0}, {302, 1} };
+  conferirTrocas(esperadas, TAMANHO(esperadas), filtrado, n);
+  TEST_ASSERT_GREATER_THAN(100, contarTrocas(cru, n));
+}
+
+// A EMA em inteiros fica a menos de uma contagem da mesma conta em float
+void test_media_contra_float() {
+  MediaExp<3> e;
+  double referencia = TRACO_LDR[0];
+  for (size_t k = 0; k < TAMANHO(TRACO_LDR); k++) {
+    if (k > 0) referencia += (TRACO_LDR[k] - referencia) / 8.0;
+    int16_t y = e.filtrar(TRACO_LDR[k]);
+    TEST_ASSERT_FLOAT_WITHIN(1.0, referencia, y);
+  }
+}
+
+// Umidade: a oscilação em volta de 70% não troca; o degrau para 75% sim
+void test_traco_umidade() {
+  const size_t n = TAMANHO(TRACO_UMIDADE);
+  uint8_t filtrado[n];
+  Faixas<10, 700> faixas;
+  for (size_t k = 0; k < n; k++) filtrado[k] = faixas.filtrar(TRACO_UMIDADE[k]);
+
+  const Troca esperadas[] = { {0, 0}, {50, 1} };
+  conferirTrocas(esperadas, TAMANHO(esperadas), filtrado, n);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_mediana);
+  RUN_TEST(test_media_exponencial);
+  RUN_TEST(test_cadeia_igual_aos_estagios);
+  RUN_TEST(test_faixas_histerese);
+  RUN_TEST(test_traco_sonar);
+  RUN_TEST(test_traco_ldr);
+  RUN_TEST(test_media_contra_float);
+  RUN_TEST(test_traco_umidade);
+  return UNITY_END();
+}
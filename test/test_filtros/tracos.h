@@ -0,0 +1,74 @@
+// Traços sintéticos gerados por gerar_tracos.py; não editar à mão
+#ifndef TRACOS_H
+#define TRACOS_H
+
+#include <stdint.h>
+
+// cm, 0 = ping sem eco; degraus 60 -> 19 (amostra 130) -> 8 (amostra 270)
+const uint16_t TRACO_SONAR[] = {
+  59, 60, 57, 57, 57, 0, 60, 58, 60, 61, 58, 61, 61, 57, 57, 58,
+  58, 61, 63, 57, 62, 57, 57, 61, 62, 63, 61, 59, 63, 63, 61, 60,
+  62, 61, 57, 58, 58, 0, 62, 61, 63, 62, 60, 60, 57, 60, 57, 62,
+  61, 63, 62, 62, 60, 61, 57, 59, 58, 63, 58, 61, 58, 63, 62, 59,
+  60, 58, 58, 0, 63, 59, 58, 59, 59, 62, 61, 62, 63, 63, 61, 60,
+  60, 57, 58, 57, 57, 61, 57, 0, 63, 60, 59, 61, 57, 60, 60, 59,
+  57, 62, 63, 0, 61, 62, 57, 59, 63, 63, 59, 59, 61, 61, 58, 63,
+  63, 58, 62, 58, 59, 57, 60, 62, 59, 62, 59, 57, 58, 60, 61, 60,
+  59, 57, 16, 22, 17, 17, 21, 22, 21, 19, 16, 17, 16, 19, 17, 20,
+  21, 17, 0, 22, 21, 21, 19, 17, 0, 17, 17, 18, 19, 16, 18, 21,
+  20, 20, 17, 16, 22, 16, 17, 19, 16, 18, 20, 22, 20, 17, 22, 19,
+  22, 16, 20, 20, 21, 20, 19, 17, 18, 17, 17, 19, 16, 19, 21, 16,
+  17, 21, 17, 17, 17, 16, 19, 21, 17, 20, 19, 18, 0, 20, 0, 18,
+  18, 16, 22, 16, 0, 22, 22, 19, 21, 18, 20, 20, 18, 16, 17, 16,
+  16, 22, 20, 16, 16, 18, 19, 18, 16, 17, 17, 17, 18, 20, 18, 21,
+  18, 0, 16, 20, 20, 19, 22, 21, 22, 20, 17, 18, 21, 17, 18, 22,
+  16, 18, 16, 22, 20, 18, 21, 19, 18, 18, 18, 20, 16, 18, 0, 8,
+  7, 6, 0, 7, 6, 5, 7, 6, 9, 6, 10, 9, 7, 8, 10, 0,
+  11, 9, 10, 9, 9, 9, 0, 10, 10, 10, 0, 6, 5, 8, 0, 9,
+  8, 8, 10, 9, 9, 10, 11, 7, 11, 10, 8, 8, 10, 5, 10, 9,
+  7, 10, 9, 8, 7, 5, 10, 10, 8, 11, 9, 5, 5, 5, 8, 8,
+  6, 5, 9, 7, 11, 7, 10, 8, 8, 0, 8, 8, 6, 8, 11, 7,
+  11, 6, 10, 7, 8, 9, 8, 0, 5, 10, 6, 7, 7, 7, 8, 11,
+  8, 9, 10, 10, 9, 10, 0, 9, 8, 7, 10, 10, 10, 8, 8, 10,
+  6, 11, 6, 7, 8, 9, 5, 9, 6, 11, 5, 8, 10, 8, 11, 7,
+};
+
+// analogRead(); 62 -> 20 na amostra 300, limite em 60
+const int16_t TRACO_LDR[] = {
+  65, 58, 70, 70, 60, 56, 62, 61, 66, 66, 68, 67, 63, 54, 58, 55,
+  67, 69, 69, 54, 56, 66, 70, 68, 68, 61, 57, 61, 58, 58, 70, 57,
+  68, 56, 55, 54, 58, 61, 55, 63, 58, 62, 70, 67, 57, 57, 56, 63,
+  70, 60, 66, 62, 61, 54, 54, 63, 68, 62, 64, 61, 69, 70, 61, 61,
+  54, 67, 63, 55, 54, 60, 69, 67, 56, 62, 61, 67, 65, 61, 69, 55,
+  64, 67, 65, 66, 60, 54, 63, 70, 56, 60, 69, 60, 63, 60, 61, 68,
+  61, 62, 63, 57, 69, 59, 61, 69, 67, 55, 58, 66, 55, 60, 54, 58,
+  67, 55, 55, 59, 66, 68, 64, 57, 56, 59, 64, 60, 59, 70, 68, 55,
+  63, 66, 65, 64, 68, 59, 57, 54, 56, 62, 56, 65, 67, 57, 60, 66,
+  65, 63, 67, 56, 55, 69, 60, 65, 68, 60, 64, 65, 69, 54, 67, 61,
+  66, 55, 66, 55, 68, 56, 55, 62, 60, 56, 64, 65, 62, 64, 55, 62,
+  64, 62, 63, 54, 56, 54, 61, 57, 69, 68, 66, 62, 67, 69, 58, 69,
+  59, 54, 63, 58, 61, 64, 64, 68, 65, 56, 70, 60, 66, 59, 61, 67,
+  56, 55, 69, 64, 59, 67, 57, 56, 62, 56, 60, 57, 67, 69, 68, 59,
+  61, 58, 67, 68, 61, 57, 63, 63, 62, 62, 65, 62, 62, 60, 68, 61,
+  59, 61, 61, 58, 63, 60, 64, 56, 66, 62, 61, 70, 70, 61, 57, 68,
+  55, 57, 54, 69, 61, 68, 65, 55, 63, 61, 57, 55, 60, 60, 56, 65,
+  70, 59, 68, 62, 54, 57, 65, 60, 55, 65, 64, 58, 55, 60, 62, 55,
+  60, 54, 64, 67, 65, 59, 63, 56, 60, 55, 69, 69, 14, 25, 15, 24,
+  16, 14, 17, 24, 20, 25, 21, 21, 25, 13, 21, 23, 25, 25, 12, 23,
+  18, 24, 24, 18, 12, 25, 17, 25, 15, 14, 24, 23, 26, 17, 16, 12,
+  13, 16, 24, 14, 23, 28, 17, 16, 23, 21, 17, 28, 17, 14, 15, 24,
+  27, 18, 21, 16, 13, 27, 22, 13, 24, 14, 17, 19, 24, 18, 27, 17,
+  18, 13, 24, 28, 17, 24, 23, 15, 16, 19, 18, 13, 13, 22, 15, 24,
+  26, 21, 25, 21, 19, 25, 24, 23, 26, 28, 26, 17, 12, 12, 27, 26,
+};
+
+// décimos de %; 65%, oscila em volta de 70% (amostras 10-49) e sobe para 75%
+const int16_t TRACO_UMIDADE[] = {
+  649, 651, 652, 651, 649, 651, 651, 648, 648, 649, 708, 695, 708, 695, 708, 695,
+  708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695,
+  708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695, 708, 695,
+  708, 695, 750, 751, 750, 748, 751, 752, 752, 748, 748, 749, 748, 750, 752, 748,
+  748, 752, 751, 749, 748, 748,
+};
+
+#endif
@@ -0,0 +1,277 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "frame.h"
+
+// Pool de frames de saída (src/agario/frame.h) no host, e o custo de um
+// broadcast a 10 e 32 clientes contra o caminho de antes do pool:
+//   - antes: serializeJson num String (o Writer do ArduinoJson junta 31
+//     bytes e faz String::concat, que realoca no tamanho exato) e
+//     broadcastTXT(String); para cada cliente, frames < 1400 bytes eram
+//     copiados num malloc(len + cabeçalho) para sair num pacote TCP só
+//   - agora: payload escrito no buffer do pool e headerToPayload, a
+//     biblioteca escreve o cabeçalho no lugar, sem alocar
+// Nos dois casos cada cliente custa a cópia para o buffer de envio do TCP.
+// Os números são de um modelo no host, não do ESP32. Os de 32 clientes são
+// uma projeção: o servidor não passa de MAX_PLAYERS (10) jogadores. O heap
+// real (mínimo livre e com quantos clientes) sai no relatório serial do
+// servidor a cada STATS_INTERVAL.
+
+#define SMALL_FRAME_SIZE 2048
+#define LARGE_FRAME_SIZE (200 * 64)
+#define MODELED_CLIENTS_MAX 10   // acima disso só existe no modelo (MAX_PLAYERS do servidor)
+#define ONE_PACKET_MAX 1400   // limite do "pack to one TCP package" da WebSockets
+
+static FramePool<5> pool;
+static const size_t capacities[5] = {
+  SMALL_FRAME_SIZE, SMALL_FRAME_SIZE, SMALL_FRAME_SIZE, LARGE_FRAME_SIZE, LARGE_FRAME_SIZE
+};
+
+// Heap do caminho antigo: chamadas (malloc/realloc), bytes pedidos e pico em uso
+struct HeapCount {
+  uint32_t calls;
+  size_t bytes;
+  size_t live;
+  size_t peak;
+};
+
+static HeapCount heap;
+
+static void* countedRealloc(void* ptr, size_t oldSize, size_t size) {
+  heap.calls++;
+  heap.bytes += size;
+  heap.live += size - oldSize;
+  if (heap.live > heap.peak) heap.peak = heap.live;
+  return realloc(ptr, size);
+}
+
+static void countedFree(void* ptr, size_t size) {
+  heap.live -= size;
+  free(ptr);
+}
+
+// Arduino String com o Writer do ArduinoJson na frente
+struct StringModel {
+  char* buf = NULL;
+  size_t len = 0;
+  char chunk[32];
+  size_t chunkLen = 0;
+
+  void flush() {
+    if (chunkLen == 0) return;
+    buf = (char*)countedRealloc(buf, buf ? len + 1 : 0, len + chunkLen + 1);
+    memcpy(buf + len, chunk, chunkLen);
+    len += chunkLen;
+    buf[len] = '\0';
+    chunkLen = 0;
+  }
+
+  void write(const char* s) {
+    for (; *s; s++) {
+      chunk[chunkLen++] = *s;
+      if (chunkLen == sizeof(chunk) - 1) flush();
+    }
+  }
+
+  ~StringModel() {
+    if (buf) countedFree(buf, len + 1);
+  }
+};
+
+// Buffer de envio do TCP: toda versão copia o frame para cá
+static uint8_t tcp[WEBSOCKETS_MAX_HEADER_SIZE + LARGE_FRAME_SIZE];
+static volatile uint8_t sink;
+
+static void tcpWrite(const uint8_t* data, size_t len) {
+  memcpy(tcp, data, len);
+  sink = tcp[len / 2];
+}
+
+static void writeHeader(uint8_t* at, size_t len) {
+  at[0] = 0x81;
+  at[1] = len < 126 ? len : 126;
+  at[2] = len >> 8;
+  at[3] = len;
+}
+
+// sendFrame(headerToPayload = false) da biblioteca
+static void sendCopied(const uint8_t* payload, size_t len) {
+  if (len < ONE_PACKET_MAX) {
+    size_t size = len + WEBSOCKETS_MAX_HEADER_SIZE;
+    uint8_t* data = (uint8_t*)countedRealloc(NULL, 0, size);
+    memcpy(data + WEBSOCKETS_MAX_HEADER_SIZE, payload, len);
+    writeHeader(data + WEBSOCKETS_MAX_HEADER_SIZE - 4, len);
+    tcpWrite(data + WEBSOCKETS_MAX_HEADER_SIZE - 4, len + 4);
+    countedFree(data, size);
+  } else {
+    uint8_t header[4];
+    writeHeader(header, len);
+    tcpWrite(header, sizeof(header));
+    tcpWrite(payload, len);
+  }
+}
+
+// sendFrame(headerToPayload = true): cabeçalho no espaço reservado
+static void sendInPlace(Frame* frame) {
+  uint8_t* start = frame->buf + WEBSOCKETS_MAX_HEADER_SIZE - 4;
+  writeHeader(start, frame->len);
+  tcpWrite(start, frame->len + 4);
+}
+
+// Um bloco de pellets como writePelletChunk e um snapshot de jogadores
+static const char* const colors[] = { "rgb(255,130,7)", "rgb(7,255,171)", "rgb(205,7,255)" };
+
+template <typename Out>
+static void pelletChunk(Out& out) {
+  char item[64];
+  out.write("{\"type\":\"pellets\",\"start\":0,\"pellets\":[");
+  for (int i = 0; i < 200; i++) {
+    snprintf(item, sizeof(item), "%s{\"x\":%d,\"y\":%d,\"r\":1,\"color\":\"%s\"}",
+             i ? "," : "", (i * 2654435761u) % 4980 + 10, (i * 40503u) % 4980 + 10, colors[i % 3]);
+    out.write(item);
+  }
+  out.write("]}");
+}
+
+template <typename Out>
+static void playersSnapshot(Out& out) {
+  char item[160];
+  out.write("{\"type\":\"players\",\"players\":{");
+  for (int i = 0; i < 10; i++) {
+    snprintf(item, sizeof(item),
+             "%s\"bot1.%d\":{\"x\":%.7g,\"y\":%.7g,\"r\":%.7g,\"ack\":0,\"name\":\"Bot %d\","
+             "\"fillColor\":\"%s\",\"strokeColor\":\"%s\"}",
+             i ? "," : "", i, 1234.567 + i * 311.1, 987.6543 + i * 97.3, 24.5 + i, i, colors[i % 3], colors[i % 3]);
+    out.write(item);
+  }
+  out.write("}}");
+}
+
+struct FrameWriter {
+  Frame* frame;
+  void write(const char* s) { frame->append(s); }
+};
+
+static size_t broadcastOld(bool pellets, int clients) {
+  StringModel msg;
+  if (pellets) pelletChunk(msg);
+  else playersSnapshot(msg);
+  msg.flush();
+  for (int c = 0; c < clients; c++) sendCopied((const uint8_t*)msg.buf, msg.len);
+  return msg.len;
+}
+
+static size_t broadcastPooled(bool pellets, int clients) {
+  Frame* frame = pool.acquire(pellets ? LARGE_FRAME_SIZE : SMALL_FRAME_SIZE);
+  FrameWriter out = { frame };
+  if (pellets) pelletChunk(out);
+  else playersSnapshot(out);
+  for (int c = 0; c < clients; c++) sendInPlace(frame);
+  size_t len = frame->len;
+  pool.release(frame);
+  return len;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_pool_acquire_release() {
+  static bool started = pool.begin(capacities);
+  TEST_ASSERT_TRUE(started);
+
+  // Pequenos primeiro; um pedido grande não pega buffer pequeno
+  Frame* a = pool.acquire(100);
+  Frame* b = pool.acquire(SMALL_FRAME_SIZE);
+  Frame* c = pool.acquire(SMALL_FRAME_SIZE + 1);
+  TEST_ASSERT_EQUAL(SMALL_FRAME_SIZE, a->capacity);
+  TEST_ASSERT_EQUAL(SMALL_FRAME_SIZE, b->capacity);
+  TEST_ASSERT_EQUAL(LARGE_FRAME_SIZE, c->capacity);
+
+  // Acabando os pequenos, pedido pequeno usa um grande
+  Frame* d = pool.acquire(10);
+  Frame* e = pool.acquire(10);
+  TEST_ASSERT_EQUAL(SMALL_FRAME_SIZE, d->capacity);
+  TEST_ASSERT_EQUAL(LARGE_FRAME_SIZE, e->capacity);
+  TEST_ASSERT_NULL(pool.acquire(10));
+  TEST_ASSERT_NULL(pool.acquire(LARGE_FRAME_SIZE + 1));
+
+  pool.release(b);
+  Frame* f = pool.acquire(10);
+  TEST_ASSERT_TRUE(f == b);
+  TEST_ASSERT_EQUAL(0, f->len);
+  pool.release(NULL);
+  pool.release(a);
+  pool.release(c);
+  pool.release(d);
+  pool.release(e);
+  pool.release(f);
+}
+
+void test_append_overflow() {
+  Frame* frame = pool.acquire(SMALL_FRAME_SIZE);
+  frame->append("{\"a\":");
+  frame->appendf("%d}", 12);
+  TEST_ASSERT_EQUAL(8, frame->len);
+  TEST_ASSERT_EQUAL_MEMORY("{\"a\":12}", frame->payload(), 8);
+  TEST_ASSERT_FALSE(frame->overflow);
+
+  char big[SMALL_FRAME_SIZE];
+  memset(big, 'x', sizeof(big) - 1);
+  big[sizeof(big) - 1] = '\0';
+  frame->append(big);
+  TEST_ASSERT_TRUE(frame->overflow);
+  TEST_ASSERT_EQUAL(8, frame->len);
+  pool.release(frame);
+}
+
+// Os dois caminhos mandam os mesmos bytes
+void test_same_payload() {
+  StringModel msg;
+  playersSnapshot(msg);
+  msg.flush();
+  Frame* frame = pool.acquire(SMALL_FRAME_SIZE);
+  FrameWriter out = { frame };
+  playersSnapshot(out);
+  TEST_ASSERT_EQUAL(msg.len, frame->len);
+  TEST_ASSERT_EQUAL_MEMORY(msg.buf, frame->payload(), msg.len);
+  pool.release(frame);
+}
+
+static void compare(const char* name, bool pellets, int clients) {
+  const int rounds = 5000;
+  broadcastOld(pellets, clients);
+  broadcastPooled(pellets, clients);
+  memset(&heap, 0, sizeof(heap));
+  size_t len = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) len = broadcastOld(pellets, clients);
+  auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) broadcastPooled(pellets, clients);
+  auto t2 = std::chrono::steady_clock::now();
+
+  TEST_ASSERT_EQUAL(0, heap.live);
+  double usOld = std::chrono::duration<double, std::micro>(t1 - t0).count() / rounds;
+  double usPool = std::chrono::duration<double, std::micro>(t2 - t1).count() / rounds;
+  char msg[220];
+  snprintf(msg, sizeof(msg),
+           "%s (%u B) a %d clientes%s: String %.1f us, %u allocs, %u B pedidos, pico %u B | pool %.1f us, 0 allocs",
+           name, (unsigned)len, clients, clients > MODELED_CLIENTS_MAX ? " (projeção)" : "", usOld, (unsigned)(heap.calls / rounds),
+           (unsigned)(heap.bytes / rounds), (unsigned)heap.peak, usPool);
+  TEST_MESSAGE(msg);
+}
+
+void test_broadcast_10_and_32_clients() {
+  compare("players", false, 10);
+  compare("players", false, 32);
+  compare("pellets", true, 10);
+  compare("pellets", true, 32);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_pool_acquire_release);
+  RUN_TEST(test_append_overflow);
+  RUN_TEST(test_same_payload);
+  RUN_TEST(test_broadcast_10_and_32_clients);
+  return UNITY_END();
+}
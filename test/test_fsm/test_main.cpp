@@ -0,0 +1,203 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "fsm.h"
+
+// Máquina de estados (include/fsm.h) no host, com a mesma tabela do
+// src/esp/main.cpp e uma guarda de teste no CHRG -> CLEAN
+
+enum EstadoRobo : uint8_t { IDLE, CLEAN, DOCK, CHRG, N_ESTADOS };
+enum EventoRobo : uint8_t { EV_LIMPAR, EV_DOCAR, EV_TEMPO, N_EVENTOS };
+
+// Registro das chamadas, na ordem em que aconteceram
+static char trilha[64];
+static size_t nTrilha = 0;
+static void marcar(char c) {
+  if (nTrilha < sizeof(trilha) - 1) trilha[nTrilha++] = c;
+  trilha[nTrilha] = '\0';
+}
+
+static bool bateriaCheia = true;
+static volatile uint32_t voltas = 0;
+
+static void entrarIdle() { marcar('i'); }
+static void sairIdle() { marcar('I'); }
+static void limpando() { voltas++; }
+static void entrarDock() { marcar('d'); }
+static bool podeLimpar() { return bateriaCheia; }
+
+static const AcoesEstado estados[N_ESTADOS] PROGMEM = {
+  { "IDLE",  entrarIdle, NULL,     sairIdle },
+  { "CLEAN", NULL,       limpando, NULL },
+  { "DOCK",  entrarDock, NULL,     NULL },
+  { "CHRG",  NULL,       NULL,     NULL },
+};
+
+#define SEM_TRANSICAO { FSM_SEM_TRANSICAO, NULL }
+
+static const Transicao transicoes[N_ESTADOS][N_EVENTOS] PROGMEM = {
+  //           EV_LIMPAR                EV_DOCAR          EV_TEMPO
+  /* IDLE  */ { { CLEAN, NULL },         SEM_TRANSICAO,    SEM_TRANSICAO },
+  /* CLEAN */ { SEM_TRANSICAO,           { DOCK, NULL },   { DOCK, NULL } },
+  /* DOCK  */ { SEM_TRANSICAO,           SEM_TRANSICAO,    { CHRG, NULL } },
+  /* CHRG  */ { { CLEAN, podeLimpar },   SEM_TRANSICAO,    { IDLE, NULL } },
+};
+
+static uint8_t ultimaDe = 0xFF, ultimaPara = 0xFF;
+static void mudou(uint8_t de, uint8_t para) {
+  ultimaDe = de;
+  ultimaPara = para;
+  marcar('>');
+}
+
+void setUp(void) {
+  nTrilha = 0;
+  trilha[0] = '\0';
+  bateriaCheia = true;
+  ultimaDe = ultimaPara = 0xFF;
+}
+void tearDown(void) {}
+
+// Cada célula da tabela: destino esperado ou FSM_SEM_TRANSICAO
+void test_tabela_completa() {
+  const uint8_t esperado[N_ESTADOS][N_EVENTOS] = {
+    { CLEAN,             FSM_SEM_TRANSICAO, FSM_SEM_TRANSICAO },
+    { FSM_SEM_TRANSICAO, DOCK,              DOCK },
+    { FSM_SEM_TRANSICAO, FSM_SEM_TRANSICAO, CHRG },
+    { CLEAN,             FSM_SEM_TRANSICAO, IDLE },
+  };
+  for (uint8_t e = 0; e < N_ESTADOS; e++) {
+    for (uint8_t ev = 0; ev < N_EVENTOS; ev++) {
+      Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes);
+      m.iniciar(e);
+      bool trocou = m.disparar(ev);
+      uint8_t para = esperado[e][ev];
+      TEST_ASSERT_EQUAL(para != FSM_SEM_TRANSICAO, trocou);
+      TEST_ASSERT_EQUAL_UINT8(trocou ? para : e, m.atual());
+    }
+  }
+}
+
+void test_ciclo_completo() {
+  Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes, mudou);
+  m.iniciar(IDLE);
+  TEST_ASSERT_TRUE(m.disparar(EV_LIMPAR));
+  TEST_ASSERT_EQUAL_STRING("CLEAN", m.nome());
+  TEST_ASSERT_TRUE(m.disparar(EV_TEMPO));
+  TEST_ASSERT_TRUE(m.disparar(EV_TEMPO));
+  TEST_ASSERT_EQUAL_STRING("CHRG", m.nome());
+  TEST_ASSERT_TRUE(m.disparar(EV_TEMPO));
+  TEST_ASSERT_EQUAL_UINT8(IDLE, m.atual());
+  TEST_ASSERT_EQUAL_UINT8(CHRG, ultimaDe);
+  TEST_ASSERT_EQUAL_UINT8(IDLE, ultimaPara);
+}
+
+// Saída do estado antigo, aoMudar, entrada do novo; evento ignorado não
+// chama nada
+void test_ordem_das_acoes() {
+  Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes, mudou);
+  m.iniciar(IDLE);
+  TEST_ASSERT_EQUAL_STRING("i", trilha);
+  TEST_ASSERT_FALSE(m.disparar(EV_DOCAR));
+  TEST_ASSERT_EQUAL_STRING("i", trilha);
+  m.disparar(EV_LIMPAR);
+  m.disparar(EV_DOCAR);
+  TEST_ASSERT_EQUAL_STRING("iI>>d", trilha);
+}
+
+void test_guarda_bloqueia() {
+  Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes, mudou);
+  m.iniciar(CHRG);
+  bateriaCheia = false;
+  TEST_ASSERT_FALSE(m.disparar(EV_LIMPAR));
+  TEST_ASSERT_EQUAL_UINT8(CHRG, m.atual());
+  TEST_ASSERT_EQUAL_UINT8(0xFF, ultimaPara);
+  bateriaCheia = true;
+  TEST_ASSERT_TRUE(m.disparar(EV_LIMPAR));
+  TEST_ASSERT_EQUAL_UINT8(CLEAN, m.atual());
+}
+
+void test_executar_e_nomes() {
+  Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes);
+  m.iniciar(CLEAN);
+  voltas = 0;
+  m.executar();
+  m.executar();
+  TEST_ASSERT_EQUAL_UINT32(2, voltas);
+  m.irPara(DOCK);
+  m.executar();   // DOCK não tem executar
+  TEST_ASSERT_EQUAL_UINT32(2, voltas);
+  TEST_ASSERT_EQUAL_STRING("IDLE", m.nome(IDLE));
+  TEST_ASSERT_EQUAL_STRING("?", m.nome(N_ESTADOS));
+}
+
+// O loop() de antes da tabela: switch no estado e ifs por evento
+static uint8_t estadoSwitch = IDLE;
+static bool dispararSwitch(uint8_t evento) {
+  uint8_t para = FSM_SEM_TRANSICAO;
+  switch (estadoSwitch) {
+    case IDLE:
+      if (evento == EV_LIMPAR) para = CLEAN;
+      break;
+    case CLEAN:
+      if (evento == EV_DOCAR || evento == EV_TEMPO) para = DOCK;
+      break;
+    case DOCK:
+      if (evento == EV_TEMPO) para = CHRG;
+      break;
+    case CHRG:
+      if (evento == EV_LIMPAR && podeLimpar()) para = CLEAN;
+      else if (evento == EV_TEMPO) para = IDLE;
+      break;
+  }
+  if (para == FSM_SEM_TRANSICAO) return false;
+  estadoSwitch = para;
+  return true;
+}
+
+// Custo de despacho: mesma sequência de eventos nas duas formas, com os
+// mesmos estados no fim. Só comparação; no host os dois ficam em ns.
+void test_custo_despacho() {
+  const uint32_t n = 4000000;
+  uint8_t eventos[256];
+  uint32_t x = 12345;
+  for (size_t k = 0; k < sizeof(eventos); k++) {
+    x = x * 1103515245u + 12345u;
+    eventos[k] = (x >> 16) % N_EVENTOS;
+  }
+
+  Maquina<N_ESTADOS, N_EVENTOS> m(estados, transicoes);
+  m.iniciar(CLEAN);
+  estadoSwitch = CLEAN;
+
+  uint32_t trocasTabela = 0, trocasSwitch = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t k = 0; k < n; k++) trocasTabela += m.disparar(eventos[k & 0xFF]);
+  auto t1 = std::chrono::steady_clock::now();
+  for (uint32_t k = 0; k < n; k++) trocasSwitch += dispararSwitch(eventos[k & 0xFF]);
+  auto t2 = std::chrono::steady_clock::now();
+
+  TEST_ASSERT_EQUAL_UINT32(trocasSwitch, trocasTabela);
+  TEST_ASSERT_EQUAL_UINT8(estadoSwitch, m.atual());
+
+  double nsTabela = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+  double nsSwitch = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "despacho: tabela %.2f ns/evento, switch %.2f ns/evento (%u trocas)",
+           nsTabela, nsSwitch, (unsigned)trocasTabela);
+  TEST_MESSAGE(msg);
+  snprintf(msg, sizeof(msg), "tabelas: %u bytes de AcoesEstado + %u de Transicao neste host",
+           (unsigned)sizeof(estados), (unsigned)sizeof(transicoes));
+  TEST_MESSAGE(msg);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_tabela_completa);
+  RUN_TEST(test_ciclo_completo);
+  RUN_TEST(test_ordem_das_acoes);
+  RUN_TEST(test_guarda_bloqueia);
+  RUN_TEST(test_executar_e_nomes);
+  RUN_TEST(test_custo_despacho);
+  return UNITY_END();
+}
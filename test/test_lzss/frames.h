@@ -0,0 +1,579 @@
+// Frames sintéticos gerados por gerar_frames.py; não editar à mão
+#ifndef FRAMES_H
+#define FRAMES_H
+
+// Snapshot completo de pellets em 5 blocos de 200 (writePelletChunk)
+const char* const PELLET_FRAMES[] = {
+  "{\"type\":\"pellets\",\"start\":0,\"pellets\":[{\"x\":4426,\"y\":2379,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1730,"
+  "\"y\":2117,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3263,\"y\":3091,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":676"
+  ",\"y\":3790,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4289,\"y\":1997,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":60"
+  "5,\"y\":1319,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3301,\"y\":2864,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":5"
+  "64,\"y\":3298,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2046,\"y\":4620,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3"
+  "522,\"y\":4643,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2290,\"y\":4616,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\""
+  ":4060,\"y\":2542,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2538,\"y\":2563,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x"
+  "\":4163,\"y\":668,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2002,\"y\":2587,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\""
+  "x\":245,\"y\":3366,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2475,\"y\":1477,\"r\":1,\"color\":\"rgb(205,7,255)\"},{"
+  "\"x\":1536,\"y\":3876,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4213,\"y\":3706,\"r\":1,\"color\":\"rgb(81,255,7)\"},{"
+  "\"x\":4269,\"y\":2776,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":175,\"y\":851,\"r\":1,\"color\":\"rgb(7,133,255)\"},{"
+  "\"x\":3988,\"y\":2152,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2088,\"y\":4766,\"r\":1,\"color\":\"rgb(255,14,7)\"},"
+  "{\"x\":1402,\"y\":1527,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4207,\"y\":2343,\"r\":1,\"color\":\"rgb(7,191,255)\""
+  "},{\"x\":1857,\"y\":1757,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3039,\"y\":3546,\"r\":1,\"color\":\"rgb(255,14,7)"
+  "\"},{\"x\":4193,\"y\":3124,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2479,\"y\":3871,\"r\":1,\"color\":\"rgb(81,255,7"
+  ")\"},{\"x\":2552,\"y\":4252,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1309,\"y\":2434,\"r\":1,\"color\":\"rgb(205,7,2"
+  "55)\"},{\"x\":2637,\"y\":177,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":989,\"y\":2751,\"r\":1,\"color\":\"rgb(205,7,2"
+  "55)\"},{\"x\":277,\"y\":4774,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2089,\"y\":3219,\"r\":1,\"color\":\"rgb(205,7,"
+  "255)\"},{\"x\":312,\"y\":3636,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1191,\"y\":4884,\"r\":1,\"color\":\"rgb(7,133"
+  ",255)\"},{\"x\":3065,\"y\":2177,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4242,\"y\":1145,\"r\":1,\"color\":\"rgb(254"
+  ",255,0)\"},{\"x\":3202,\"y\":4330,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2732,\"y\":223,\"r\":1,\"color\":\"rgb(7,"
+  "255,171)\"},{\"x\":3348,\"y\":4740,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":36,\"y\":1179,\"r\":1,\"color\":\"rgb(7,"
+  "191,255)\"},{\"x\":535,\"y\":3128,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2406,\"y\":2458,\"r\":1,\"color\":\"rgb(2"
+  "55,130,7)\"},{\"x\":2587,\"y\":2813,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3930,\"y\":3676,\"r\":1,\"color\":\"rgb"
+  "(255,7,139)\"},{\"x\":2927,\"y\":4016,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4713,\"y\":1463,\"r\":1,\"color\":\"r"
+  "gb(255,7,139)\"},{\"x\":1998,\"y\":2734,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3208,\"y\":876,\"r\":1,\"color\":\""
+  "rgb(7,255,171)\"},{\"x\":1653,\"y\":3914,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":882,\"y\":3247,\"r\":1,\"color\":"
+  "\"rgb(255,7,139)\"},{\"x\":1421,\"y\":1310,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2827,\"y\":184,\"r\":1,\"color\""
+  ":\"rgb(254,255,0)\"},{\"x\":3063,\"y\":4249,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2500,\"y\":1570,\"r\":1,\"colo"
+  "r\":\"rgb(81,255,7)\"},{\"x\":1236,\"y\":4737,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1589,\"y\":4906,\"r\":1,\"col"
+  "or\":\"rgb(254,255,0)\"},{\"x\":1183,\"y\":3639,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4912,\"y\":1833,\"r\":1,\"c"
+  "olor\":\"rgb(81,255,7)\"},{\"x\":4120,\"y\":1184,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1358,\"y\":2478,\"r\":1,\""
+  "color\":\"rgb(7,191,255)\"},{\"x\":1661,\"y\":2368,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3405,\"y\":2381,\"r\":1"
+  ",\"color\":\"rgb(255,130,7)\"},{\"x\":3283,\"y\":2263,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3943,\"y\":2238,\"r\""
+  ":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3434,\"y\":3809,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":771,\"y\":3851,\"r"
+  "\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1964,\"y\":377,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3719,\"y\":1713,\""
+  "r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1128,\"y\":942,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2110,\"y\":153,\""
+  "r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":611,\"y\":2881,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4216,\"y\":3625,"
+  "\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3971,\"y\":3710,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":525,\"y\":1575,"
+  "\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1430,\"y\":206,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":603,\"y\":895,\""
+  "r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1437,\"y\":2331,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4893,\"y\":3684,"
+  "\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4381,\"y\":3200,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":367,\"y\":4484,"
+  "\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":99,\"y\":921,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2435,\"y\":2276,\""
+  "r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3237,\"y\":1479,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":584,\"y\":938,\"r"
+  "\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3489,\"y\":1056,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4651,\"y\":3007,"
+  "\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3371,\"y\":648,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1500,\"y\":3937,"
+  "\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3064,\"y\":1317,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2818,\"y\":322"
+  "3,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4235,\"y\":1470,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3071,\"y\":1"
+  "923,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2086,\"y\":168,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":754,\"y\":11"
+  "92,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4114,\"y\":2597,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2045,\"y\":"
+  "1090,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1256,\"y\":1861,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":936,\"y\""
+  ":2672,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":315,\"y\":1840,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4314,\"y"
+  "\":269,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4281,\"y\":3434,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4167,\"y"
+  "\":1834,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1366,\"y\":2311,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2722,\""
+  "y\":1502,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1711,\"y\":2850,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1520"
+  ",\"y\":421,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1856,\"y\":1239,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":303"
+  "7,\"y\":4563,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2737,\"y\":4662,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4"
+  "687,\"y\":4524,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2036,\"y\":3923,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\""
+  ":4937,\"y\":2423,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4687,\"y\":4092,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x"
+  "\":222,\"y\":976,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":327,\"y\":2049,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\""
+  ":3895,\"y\":3997,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4714,\"y\":4708,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x"
+  "\":837,\"y\":3930,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1480,\"y\":1140,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\""
+  "x\":718,\"y\":41,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3482,\"y\":3213,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\""
+  ":4376,\"y\":1799,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1163,\"y\":4315,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\""
+  "x\":990,\"y\":3907,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3721,\"y\":883,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\""
+  "x\":2618,\"y\":2100,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1375,\"y\":3481,\"r\":1,\"color\":\"rgb(255,7,139)\"},{"
+  "\"x\":1320,\"y\":3552,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3179,\"y\":2472,\"r\":1,\"color\":\"rgb(255,14,7)\"},{"
+  "\"x\":3690,\"y\":2812,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1107,\"y\":660,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":3404,\"y\":1944,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":404,\"y\":937,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\""
+  "x\":2607,\"y\":3101,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1527,\"y\":3721,\"r\":1,\"color\":\"rgb(7,191,255)\"},{"
+  "\"x\":4614,\"y\":894,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3490,\"y\":4000,\"r\":1,\"color\":\"rgb(255,7,139)\"},"
+  "{\"x\":3252,\"y\":3304,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2234,\"y\":3407,\"r\":1,\"color\":\"rgb(81,255,7)\"}"
+  ",{\"x\":3171,\"y\":1860,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2586,\"y\":989,\"r\":1,\"color\":\"rgb(255,7,139)\"}"
+  ",{\"x\":4332,\"y\":3199,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":133,\"y\":95,\"r\":1,\"color\":\"rgb(205,7,255)\"},"
+  "{\"x\":4017,\"y\":608,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3569,\"y\":1509,\"r\":1,\"color\":\"rgb(255,130,7)\"}"
+  ",{\"x\":3311,\"y\":1688,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":468,\"y\":2887,\"r\":1,\"color\":\"rgb(254,255,0)\""
+  "},{\"x\":4063,\"y\":2823,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4898,\"y\":2699,\"r\":1,\"color\":\"rgb(7,191,255"
+  ")\"},{\"x\":208,\"y\":3179,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3871,\"y\":3899,\"r\":1,\"color\":\"rgb(7,191,255"
+  ")\"},{\"x\":711,\"y\":1154,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":709,\"y\":375,\"r\":1,\"color\":\"rgb(255,7,139)"
+  "\"},{\"x\":1822,\"y\":1778,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":90,\"y\":3592,\"r\":1,\"color\":\"rgb(7,133,255)"
+  "\"},{\"x\":2702,\"y\":4533,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":691,\"y\":2783,\"r\":1,\"color\":\"rgb(205,7,255"
+  ")\"},{\"x\":837,\"y\":3024,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1850,\"y\":4200,\"r\":1,\"color\":\"rgb(7,133,25"
+  "5)\"},{\"x\":1613,\"y\":1861,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3130,\"y\":2886,\"r\":1,\"color\":\"rgb(81,255"
+  ",7)\"},{\"x\":2175,\"y\":780,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":482,\"y\":3271,\"r\":1,\"color\":\"rgb(255,7,1"
+  "39)\"},{\"x\":838,\"y\":4361,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3362,\"y\":497,\"r\":1,\"color\":\"rgb(7,191,25"
+  "5)\"},{\"x\":524,\"y\":2540,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":575,\"y\":3621,\"r\":1,\"color\":\"rgb(7,133,25"
+  "5)\"},{\"x\":4427,\"y\":2327,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3925,\"y\":692,\"r\":1,\"color\":\"rgb(254,255"
+  ",0)\"},{\"x\":2454,\"y\":4563,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":239,\"y\":2363,\"r\":1,\"color\":\"rgb(7,133,"
+  "255)\"},{\"x\":623,\"y\":748,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1218,\"y\":952,\"r\":1,\"color\":\"rgb(7,133,2"
+  "55)\"},{\"x\":2551,\"y\":3008,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3495,\"y\":951,\"r\":1,\"color\":\"rgb(7,191,2"
+  "55)\"},{\"x\":4729,\"y\":3723,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1152,\"y\":3472,\"r\":1,\"color\":\"rgb(7,191"
+  ",255)\"},{\"x\":2566,\"y\":773,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":4525,\"y\":4039,\"r\":1,\"color\":\"rgb(255,"
+  "14,7)\"},{\"x\":2680,\"y\":3117,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2431,\"y\":4954,\"r\":1,\"color\":\"rgb(81,"
+  "255,7)\"},{\"x\":156,\"y\":1713,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4960,\"y\":393,\"r\":1,\"color\":\"rgb(255,1"
+  "30,7)\"},{\"x\":3354,\"y\":3034,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2631,\"y\":3796,\"r\":1,\"color\":\"rgb(255"
+  ",7,139)\"},{\"x\":2094,\"y\":2243,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1345,\"y\":2990,\"r\":1,\"color\":\"rgb(2"
+  "55,7,139)\"},{\"x\":1533,\"y\":1530,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2682,\"y\":2433,\"r\":1,\"color\":\"rgb"
+  "(81,255,7)\"},{\"x\":2179,\"y\":703,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1797,\"y\":3715,\"r\":1,\"color\":\"rgb"
+  "(7,255,171)\"},{\"x\":2081,\"y\":176,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2214,\"y\":3872,\"r\":1,\"color\":\"rgb"
+  "(255,14,7)\"},{\"x\":195,\"y\":193,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4073,\"y\":3108,\"r\":1,\"color\":\"rgb("
+  "205,7,255)\"},{\"x\":1237,\"y\":4761,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1035,\"y\":4355,\"r\":1,\"color\":\"rg"
+  "b(205,7,255)\"}]}",
+  "{\"type\":\"pellets\",\"start\":200,\"pellets\":[{\"x\":437,\"y\":2232,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3448"
+  ",\"y\":3970,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2950,\"y\":386,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":911"
+  ",\"y\":2313,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1607,\"y\":2209,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":37"
+  "77,\"y\":4163,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3426,\"y\":3621,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":"
+  "2802,\"y\":3594,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2659,\"y\":4662,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x"
+  "\":1463,\"y\":764,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1649,\"y\":1023,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\""
+  "x\":1626,\"y\":2221,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4906,\"y\":1808,\"r\":1,\"color\":\"rgb(255,7,139)\"},"
+  "{\"x\":771,\"y\":1903,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":280,\"y\":3189,\"r\":1,\"color\":\"rgb(7,133,255)\"},{"
+  "\"x\":4159,\"y\":4060,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3718,\"y\":4356,\"r\":1,\"color\":\"rgb(7,255,171)\"},"
+  "{\"x\":3896,\"y\":307,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1146,\"y\":2813,\"r\":1,\"color\":\"rgb(255,14,7)\"},"
+  "{\"x\":3600,\"y\":791,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2479,\"y\":1550,\"r\":1,\"color\":\"rgb(255,7,139)\"}"
+  ",{\"x\":784,\"y\":1379,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":4126,\"y\":3932,\"r\":1,\"color\":\"rgb(254,255,0)\""
+  "},{\"x\":1932,\"y\":3432,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3273,\"y\":4409,\"r\":1,\"color\":\"rgb(255,130,7"
+  ")\"},{\"x\":4687,\"y\":4284,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1425,\"y\":3420,\"r\":1,\"color\":\"rgb(255,130"
+  ",7)\"},{\"x\":2754,\"y\":4700,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3389,\"y\":1133,\"r\":1,\"color\":\"rgb(255,1"
+  "30,7)\"},{\"x\":2519,\"y\":3837,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4808,\"y\":3314,\"r\":1,\"color\":\"rgb(255"
+  ",130,7)\"},{\"x\":516,\"y\":4233,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1425,\"y\":4752,\"r\":1,\"color\":\"rgb(25"
+  "4,255,0)\"},{\"x\":1382,\"y\":2555,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1249,\"y\":106,\"r\":1,\"color\":\"rgb(81"
+  ",255,7)\"},{\"x\":193,\"y\":4555,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2789,\"y\":1592,\"r\":1,\"color\":\"rgb(25"
+  "5,7,139)\"},{\"x\":4807,\"y\":3080,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3639,\"y\":4390,\"r\":1,\"color\":\"rgb("
+  "7,255,171)\"},{\"x\":3123,\"y\":1371,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2840,\"y\":2498,\"r\":1,\"color\":\"rg"
+  "b(205,7,255)\"},{\"x\":2334,\"y\":241,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2781,\"y\":3943,\"r\":1,\"color\":\"r"
+  "gb(255,7,139)\"},{\"x\":2619,\"y\":2530,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1859,\"y\":1977,\"r\":1,\"color\":"
+  "\"rgb(7,191,255)\"},{\"x\":796,\"y\":2715,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3245,\"y\":2243,\"r\":1,\"color\""
+  ":\"rgb(7,191,255)\"},{\"x\":3195,\"y\":4086,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2353,\"y\":3905,\"r\":1,\"color"
+  "\":\"rgb(255,7,139)\"},{\"x\":4653,\"y\":4124,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":617,\"y\":703,\"r\":1,\"color"
+  "\":\"rgb(255,14,7)\"},{\"x\":1495,\"y\":1611,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4322,\"y\":4076,\"r\":1,\"colo"
+  "r\":\"rgb(7,191,255)\"},{\"x\":975,\"y\":2616,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":66,\"y\":3519,\"r\":1,\"color"
+  "\":\"rgb(255,130,7)\"},{\"x\":2525,\"y\":1902,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4257,\"y\":3466,\"r\":1,\"colo"
+  "r\":\"rgb(205,7,255)\"},{\"x\":1566,\"y\":4513,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2996,\"y\":2248,\"r\":1,\"co"
+  "lor\":\"rgb(254,255,0)\"},{\"x\":325,\"y\":4063,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4736,\"y\":4047,\"r\":1,\"c"
+  "olor\":\"rgb(81,255,7)\"},{\"x\":4387,\"y\":3437,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3067,\"y\":2536,\"r\":1,\""
+  "color\":\"rgb(255,7,139)\"},{\"x\":126,\"y\":3998,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":215,\"y\":4721,\"r\":1,\""
+  "color\":\"rgb(255,14,7)\"},{\"x\":4638,\"y\":2990,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3413,\"y\":905,\"r\":1,\"c"
+  "olor\":\"rgb(81,255,7)\"},{\"x\":4461,\"y\":1509,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":237,\"y\":1894,\"r\":1,\"co"
+  "lor\":\"rgb(255,7,139)\"},{\"x\":2699,\"y\":1667,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":174,\"y\":3187,\"r\":1,\"c"
+  "olor\":\"rgb(7,255,171)\"},{\"x\":4196,\"y\":4832,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2303,\"y\":405,\"r\":1,\"c"
+  "olor\":\"rgb(255,7,139)\"},{\"x\":368,\"y\":3804,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3043,\"y\":4648,\"r\":1,\""
+  "color\":\"rgb(255,130,7)\"},{\"x\":2800,\"y\":1303,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1241,\"y\":758,\"r\":1,"
+  "\"color\":\"rgb(255,14,7)\"},{\"x\":2299,\"y\":4354,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1588,\"y\":2584,\"r\":1,"
+  "\"color\":\"rgb(7,133,255)\"},{\"x\":311,\"y\":4887,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":150,\"y\":3069,\"r\":1,"
+  "\"color\":\"rgb(81,255,7)\"},{\"x\":4092,\"y\":2461,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1034,\"y\":132,\"r\":1,"
+  "\"color\":\"rgb(255,14,7)\"},{\"x\":1698,\"y\":511,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4712,\"y\":570,\"r\":1,\""
+  "color\":\"rgb(205,7,255)\"},{\"x\":1074,\"y\":1416,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2427,\"y\":3640,\"r\":1"
+  ",\"color\":\"rgb(255,14,7)\"},{\"x\":1933,\"y\":2332,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2130,\"y\":726,\"r\":1,"
+  "\"color\":\"rgb(7,133,255)\"},{\"x\":3106,\"y\":4165,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3600,\"y\":610,\"r\":1"
+  ",\"color\":\"rgb(7,191,255)\"},{\"x\":825,\"y\":1038,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1127,\"y\":3445,\"r\":"
+  "1,\"color\":\"rgb(254,255,0)\"},{\"x\":708,\"y\":676,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2642,\"y\":1414,\"r\":1"
+  ",\"color\":\"rgb(7,133,255)\"},{\"x\":1870,\"y\":4101,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3969,\"y\":4764,\"r\":"
+  "1,\"color\":\"rgb(254,255,0)\"},{\"x\":1169,\"y\":3671,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4393,\"y\":3731,\"r"
+  "\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1722,\"y\":3712,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4749,\"y\":4161,"
+  "\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1214,\"y\":1954,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1414,\"y\":328"
+  "0,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3008,\"y\":3440,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3362,\"y\":3"
+  "71,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3989,\"y\":2824,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1491,\"y\":"
+  "1548,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2672,\"y\":1692,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1254,\"y\""
+  ":2625,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2402,\"y\":1136,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2962,\""
+  "y\":953,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3171,\"y\":4244,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1530,\""
+  "y\":3267,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3766,\"y\":2690,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4310"
+  ",\"y\":1428,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3910,\"y\":2834,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":154"
+  "4,\"y\":866,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3618,\"y\":3129,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1437"
+  ",\"y\":523,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3070,\"y\":4771,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":682"
+  ",\"y\":4735,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1860,\"y\":436,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2213"
+  ",\"y\":3734,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4026,\"y\":4892,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":53"
+  "6,\"y\":4518,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1767,\"y\":942,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":470"
+  "3,\"y\":1575,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4981,\"y\":1534,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4"
+  "654,\"y\":4851,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":282,\"y\":1304,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":"
+  "1806,\"y\":2931,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":699,\"y\":4449,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\""
+  ":774,\"y\":787,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4924,\"y\":1524,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\""
+  ":4204,\"y\":1095,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":870,\"y\":3185,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x"
+  "\":2600,\"y\":4753,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2630,\"y\":3486,\"r\":1,\"color\":\"rgb(7,133,255)\"},{"
+  "\"x\":3495,\"y\":1464,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3370,\"y\":913,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\""
+  "x\":4693,\"y\":2105,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":678,\"y\":1687,\"r\":1,\"color\":\"rgb(7,255,171)\"},{"
+  "\"x\":780,\"y\":356,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1879,\"y\":2736,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":214,\"y\":372,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4627,\"y\":1622,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\""
+  "x\":1681,\"y\":3005,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3486,\"y\":2146,\"r\":1,\"color\":\"rgb(7,255,171)\"},"
+  "{\"x\":979,\"y\":3942,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2988,\"y\":4182,\"r\":1,\"color\":\"rgb(255,130,7)\"}"
+  ",{\"x\":2525,\"y\":4829,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1384,\"y\":1969,\"r\":1,\"color\":\"rgb(255,130,7)"
+  "\"},{\"x\":1790,\"y\":1336,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2386,\"y\":3176,\"r\":1,\"color\":\"rgb(7,133,25"
+  "5)\"},{\"x\":4974,\"y\":657,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1345,\"y\":2875,\"r\":1,\"color\":\"rgb(255,14,"
+  "7)\"},{\"x\":2806,\"y\":3822,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1399,\"y\":4057,\"r\":1,\"color\":\"rgb(7,255,"
+  "171)\"},{\"x\":1182,\"y\":4202,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4637,\"y\":3668,\"r\":1,\"color\":\"rgb(255,"
+  "14,7)\"},{\"x\":220,\"y\":4015,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1883,\"y\":1278,\"r\":1,\"color\":\"rgb(255,"
+  "7,139)\"},{\"x\":1806,\"y\":1540,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":326,\"y\":3443,\"r\":1,\"color\":\"rgb(255"
+  ",14,7)\"},{\"x\":2741,\"y\":887,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3281,\"y\":3663,\"r\":1,\"color\":\"rgb(7,13"
+  "3,255)\"},{\"x\":3074,\"y\":1909,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4060,\"y\":1224,\"r\":1,\"color\":\"rgb(25"
+  "5,14,7)\"},{\"x\":4945,\"y\":2144,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4728,\"y\":2501,\"r\":1,\"color\":\"rgb(25"
+  "5,7,139)\"},{\"x\":4926,\"y\":3254,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":345,\"y\":1102,\"r\":1,\"color\":\"rgb(20"
+  "5,7,255)\"},{\"x\":2802,\"y\":4518,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":626,\"y\":4331,\"r\":1,\"color\":\"rgb(7"
+  ",255,171)\"},{\"x\":1113,\"y\":2450,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2304,\"y\":42,\"r\":1,\"color\":\"rgb(2"
+  "54,255,0)\"},{\"x\":466,\"y\":4652,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":932,\"y\":1923,\"r\":1,\"color\":\"rgb(2"
+  "54,255,0)\"},{\"x\":2370,\"y\":4580,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1490,\"y\":468,\"r\":1,\"color\":\"rgb("
+  "7,191,255)\"},{\"x\":385,\"y\":2148,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2348,\"y\":2533,\"r\":1,\"color\":\"rgb("
+  "255,7,139)\"},{\"x\":451,\"y\":4562,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2488,\"y\":4344,\"r\":1,\"color\":\"rgb"
+  "(81,255,7)\"},{\"x\":4033,\"y\":4919,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1276,\"y\":657,\"r\":1,\"color\":\"rgb("
+  "254,255,0)\"},{\"x\":2449,\"y\":276,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2560,\"y\":4930,\"r\":1,\"color\":\"rgb("
+  "7,191,255)\"},{\"x\":1143,\"y\":2935,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":33,\"y\":3654,\"r\":1,\"color\":\"rgb("
+  "7,191,255)\"},{\"x\":546,\"y\":966,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2848,\"y\":2287,\"r\":1,\"color\":\"rgb("
+  "254,255,0)\"},{\"x\":3150,\"y\":595,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4125,\"y\":491,\"r\":1,\"color\":\"rgb("
+  "255,130,7)\"},{\"x\":4174,\"y\":2842,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3400,\"y\":4633,\"r\":1,\"color\":\"rg"
+  "b(7,255,171)\"},{\"x\":3565,\"y\":3380,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3797,\"y\":3353,\"r\":1,\"color\":\""
+  "rgb(254,255,0)\"},{\"x\":2364,\"y\":780,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4380,\"y\":4395,\"r\":1,\"color\":\""
+  "rgb(81,255,7)\"}]}",
+  "{\"type\":\"pellets\",\"start\":400,\"pellets\":[{\"x\":3576,\"y\":4584,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":74,"
+  "\"y\":400,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4341,\"y\":765,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2411,"
+  "\"y\":2221,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4932,\"y\":1580,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":203"
+  "7,\"y\":309,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1909,\"y\":2714,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":359"
+  ",\"y\":4185,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2409,\"y\":651,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4857"
+  ",\"y\":2238,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3752,\"y\":2114,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":149"
+  "5,\"y\":785,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4409,\"y\":2680,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":37"
+  "82,\"y\":16,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2754,\"y\":4702,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":47"
+  "44,\"y\":4017,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":799,\"y\":2855,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":21"
+  "26,\"y\":621,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2798,\"y\":4790,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":15"
+  "75,\"y\":1598,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":719,\"y\":216,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":69,\""
+  "y\":4132,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1034,\"y\":4408,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4015"
+  ",\"y\":1687,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3846,\"y\":1803,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":304"
+  "4,\"y\":2877,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":120,\"y\":3901,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2235"
+  ",\"y\":3049,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1442,\"y\":1750,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":70"
+  "8,\"y\":157,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2008,\"y\":1124,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3080"
+  ",\"y\":2698,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2603,\"y\":488,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2538,"
+  "\"y\":3204,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1039,\"y\":2519,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4140"
+  ",\"y\":3117,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3075,\"y\":416,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4874"
+  ",\"y\":2905,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2685,\"y\":4421,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":258"
+  "4,\"y\":2889,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3721,\"y\":2897,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2"
+  "118,\"y\":1660,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4253,\"y\":920,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":"
+  "3208,\"y\":2673,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3784,\"y\":3296,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x"
+  "\":2966,\"y\":732,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":722,\"y\":2742,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x"
+  "\":1507,\"y\":3707,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3550,\"y\":4956,\"r\":1,\"color\":\"rgb(7,133,255)\"},{"
+  "\"x\":1993,\"y\":3664,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3614,\"y\":4760,\"r\":1,\"color\":\"rgb(254,255,0)\"},"
+  "{\"x\":2352,\"y\":2703,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2557,\"y\":2273,\"r\":1,\"color\":\"rgb(255,7,139)\""
+  "},{\"x\":3237,\"y\":4048,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3201,\"y\":2381,\"r\":1,\"color\":\"rgb(255,130,7"
+  ")\"},{\"x\":2558,\"y\":4360,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":489,\"y\":509,\"r\":1,\"color\":\"rgb(7,133,255"
+  ")\"},{\"x\":4066,\"y\":4882,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":67,\"y\":1049,\"r\":1,\"color\":\"rgb(7,191,255)"
+  "\"},{\"x\":2679,\"y\":2217,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4810,\"y\":2965,\"r\":1,\"color\":\"rgb(255,130,"
+  "7)\"},{\"x\":1252,\"y\":4272,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1786,\"y\":1102,\"r\":1,\"color\":\"rgb(81,255"
+  ",7)\"},{\"x\":3955,\"y\":4389,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1367,\"y\":1449,\"r\":1,\"color\":\"rgb(205,7,"
+  "255)\"},{\"x\":4676,\"y\":2511,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1418,\"y\":3315,\"r\":1,\"color\":\"rgb(7,191"
+  ",255)\"},{\"x\":3766,\"y\":2142,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1300,\"y\":3713,\"r\":1,\"color\":\"rgb(7,2"
+  "55,171)\"},{\"x\":2430,\"y\":936,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2795,\"y\":2295,\"r\":1,\"color\":\"rgb(7,"
+  "255,171)\"},{\"x\":3009,\"y\":752,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2653,\"y\":1087,\"r\":1,\"color\":\"rgb(2"
+  "54,255,0)\"},{\"x\":4665,\"y\":1754,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2869,\"y\":4890,\"r\":1,\"color\":\"rgb("
+  "7,191,255)\"},{\"x\":1485,\"y\":1603,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2069,\"y\":2483,\"r\":1,\"color\":\"rg"
+  "b(255,130,7)\"},{\"x\":4615,\"y\":1491,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":927,\"y\":4741,\"r\":1,\"color\":\"r"
+  "gb(255,14,7)\"},{\"x\":1543,\"y\":1458,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4979,\"y\":82,\"r\":1,\"color\":\"rg"
+  "b(255,130,7)\"},{\"x\":3598,\"y\":1738,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1706,\"y\":2000,\"r\":1,\"color\":\""
+  "rgb(255,14,7)\"},{\"x\":1859,\"y\":1955,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3058,\"y\":1613,\"r\":1,\"color\":"
+  "\"rgb(254,255,0)\"},{\"x\":4382,\"y\":2651,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":577,\"y\":4077,\"r\":1,\"color\""
+  ":\"rgb(255,7,139)\"},{\"x\":1983,\"y\":3515,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1620,\"y\":586,\"r\":1,\"color\""
+  ":\"rgb(255,14,7)\"},{\"x\":4097,\"y\":734,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":330,\"y\":638,\"r\":1,\"color\":\""
+  "rgb(255,14,7)\"},{\"x\":3426,\"y\":630,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2082,\"y\":3647,\"r\":1,\"color\":\"r"
+  "gb(7,255,171)\"},{\"x\":1728,\"y\":4484,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":166,\"y\":896,\"r\":1,\"color\":\"r"
+  "gb(255,14,7)\"},{\"x\":1906,\"y\":1238,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4522,\"y\":2226,\"r\":1,\"color\":\""
+  "rgb(254,255,0)\"},{\"x\":3077,\"y\":3357,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4016,\"y\":1265,\"r\":1,\"color\":"
+  "\"rgb(7,255,171)\"},{\"x\":3128,\"y\":4185,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4519,\"y\":4777,\"r\":1,\"color"
+  "\":\"rgb(255,130,7)\"},{\"x\":3032,\"y\":2031,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":621,\"y\":540,\"r\":1,\"color"
+  "\":\"rgb(7,255,171)\"},{\"x\":3908,\"y\":4824,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2915,\"y\":3563,\"r\":1,\"col"
+  "or\":\"rgb(255,14,7)\"},{\"x\":511,\"y\":363,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4542,\"y\":2624,\"r\":1,\"colo"
+  "r\":\"rgb(81,255,7)\"},{\"x\":2161,\"y\":3021,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":259,\"y\":1171,\"r\":1,\"colo"
+  "r\":\"rgb(255,130,7)\"},{\"x\":2611,\"y\":499,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":169,\"y\":1615,\"r\":1,\"colo"
+  "r\":\"rgb(205,7,255)\"},{\"x\":3594,\"y\":3098,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":298,\"y\":1844,\"r\":1,\"colo"
+  "r\":\"rgb(7,255,171)\"},{\"x\":4845,\"y\":4949,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3530,\"y\":4359,\"r\":1,\"co"
+  "lor\":\"rgb(255,14,7)\"},{\"x\":730,\"y\":3116,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1817,\"y\":4605,\"r\":1,\"co"
+  "lor\":\"rgb(7,255,171)\"},{\"x\":4130,\"y\":409,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2896,\"y\":4033,\"r\":1,\"co"
+  "lor\":\"rgb(7,191,255)\"},{\"x\":667,\"y\":2963,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2207,\"y\":2681,\"r\":1,\"c"
+  "olor\":\"rgb(81,255,7)\"},{\"x\":1985,\"y\":109,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2080,\"y\":4928,\"r\":1,\"co"
+  "lor\":\"rgb(7,191,255)\"},{\"x\":1371,\"y\":4256,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":4953,\"y\":2067,\"r\":1,\""
+  "color\":\"rgb(255,7,139)\"},{\"x\":3710,\"y\":3181,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":956,\"y\":3294,\"r\":1,\""
+  "color\":\"rgb(254,255,0)\"},{\"x\":4201,\"y\":3080,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4878,\"y\":1753,\"r\":1"
+  ",\"color\":\"rgb(81,255,7)\"},{\"x\":2275,\"y\":2639,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3621,\"y\":1331,\"r\":"
+  "1,\"color\":\"rgb(7,133,255)\"},{\"x\":2266,\"y\":1920,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1044,\"y\":3638,\"r"
+  "\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":536,\"y\":991,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1465,\"y\":836,\"r\""
+  ":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1055,\"y\":2396,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2328,\"y\":369,\"r\""
+  ":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4361,\"y\":4761,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1727,\"y\":4723,\""
+  "r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1794,\"y\":2905,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4848,\"y\":1717"
+  ",\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1022,\"y\":2354,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":606,\"y\":490"
+  "9,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":565,\"y\":1629,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":471,\"y\":3770"
+  ",\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1399,\"y\":4953,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3194,\"y\":18"
+  "10,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2177,\"y\":2700,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4046,\"y\":3"
+  "95,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":649,\"y\":690,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2803,\"y\":36"
+  "28,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":22,\"y\":1069,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4649,\"y\":3774"
+  ",\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4962,\"y\":624,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":165,\"y\":3002,"
+  "\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1901,\"y\":1753,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1333,\"y\":2485"
+  ",\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4874,\"y\":714,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4829,\"y\":151"
+  "8,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4441,\"y\":2553,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2215,\"y\":4"
+  "037,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":22,\"y\":2095,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3965,\"y\":40"
+  "1,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4538,\"y\":4883,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":112,\"y\":49"
+  "7,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":92,\"y\":1457,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3469,\"y\":144"
+  "7,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4889,\"y\":2727,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":222,\"y\":67"
+  "2,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2271,\"y\":4773,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":894,\"y\":32"
+  "86,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1482,\"y\":3506,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1997,\"y\":"
+  "3528,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1626,\"y\":2549,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1606,\"y"
+  "\":3970,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3805,\"y\":4013,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3748,"
+  "\"y\":4514,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2174,\"y\":3718,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":214"
+  "2,\"y\":3437,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":486,\"y\":1594,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":328"
+  ",\"y\":3701,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2654,\"y\":2262,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":256"
+  "3,\"y\":2125,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4878,\"y\":4241,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2"
+  "524,\"y\":1663,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":467,\"y\":134,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4"
+  "08,\"y\":3529,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3036,\"y\":2810,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":"
+  "1377,\"y\":1729,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3281,\"y\":2195,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x"
+  "\":1266,\"y\":1933,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":312,\"y\":1266,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\""
+  "x\":4201,\"y\":44,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":405,\"y\":2634,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x"
+  "\":3147,\"y\":2270,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1437,\"y\":3352,\"r\":1,\"color\":\"rgb(255,130,7)\"},{"
+  "\"x\":684,\"y\":4275,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3095,\"y\":1258,\"r\":1,\"color\":\"rgb(255,130,7)\"},"
+  "{\"x\":2399,\"y\":767,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1573,\"y\":1589,\"r\":1,\"color\":\"rgb(255,130,7)\"}"
+  "]}",
+  "{\"type\":\"pellets\",\"start\":600,\"pellets\":[{\"x\":4054,\"y\":3908,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1453"
+  ",\"y\":3800,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3365,\"y\":3057,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":49"
+  "73,\"y\":4936,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4614,\"y\":3772,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2"
+  "981,\"y\":4891,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2501,\"y\":3125,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":"
+  "4955,\"y\":1728,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2235,\"y\":4280,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x"
+  "\":3035,\"y\":705,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4538,\"y\":158,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x"
+  "\":3721,\"y\":4149,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4662,\"y\":4457,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\""
+  "x\":3859,\"y\":3493,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1242,\"y\":83,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\""
+  "x\":647,\"y\":4289,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4565,\"y\":1444,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\""
+  "x\":3679,\"y\":4898,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1047,\"y\":736,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\""
+  "x\":855,\"y\":2259,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":722,\"y\":421,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x"
+  "\":3621,\"y\":2898,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2336,\"y\":634,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\""
+  "x\":249,\"y\":964,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3308,\"y\":2745,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x"
+  "\":1222,\"y\":4577,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1418,\"y\":3836,\"r\":1,\"color\":\"rgb(254,255,0)\"},{"
+  "\"x\":931,\"y\":1445,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":4407,\"y\":4853,\"r\":1,\"color\":\"rgb(254,255,0)\"},"
+  "{\"x\":1700,\"y\":2459,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4032,\"y\":61,\"r\":1,\"color\":\"rgb(7,255,171)\"},"
+  "{\"x\":4951,\"y\":2297,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2238,\"y\":4031,\"r\":1,\"color\":\"rgb(7,133,255)\""
+  "},{\"x\":3704,\"y\":1234,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3628,\"y\":2860,\"r\":1,\"color\":\"rgb(205,7,255"
+  ")\"},{\"x\":1101,\"y\":1299,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":110,\"y\":896,\"r\":1,\"color\":\"rgb(7,191,255"
+  ")\"},{\"x\":376,\"y\":3313,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3964,\"y\":1634,\"r\":1,\"color\":\"rgb(255,14,7)"
+  "\"},{\"x\":1953,\"y\":3033,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4040,\"y\":890,\"r\":1,\"color\":\"rgb(81,255,7)"
+  "\"},{\"x\":4971,\"y\":4187,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2632,\"y\":4251,\"r\":1,\"color\":\"rgb(255,7,139"
+  ")\"},{\"x\":705,\"y\":1814,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4254,\"y\":4337,\"r\":1,\"color\":\"rgb(255,14,7"
+  ")\"},{\"x\":1533,\"y\":2556,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1495,\"y\":4079,\"r\":1,\"color\":\"rgb(255,7,1"
+  "39)\"},{\"x\":3089,\"y\":3509,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":1400,\"y\":941,\"r\":1,\"color\":\"rgb(7,255,"
+  "171)\"},{\"x\":2795,\"y\":1561,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4343,\"y\":3863,\"r\":1,\"color\":\"rgb(255,"
+  "14,7)\"},{\"x\":373,\"y\":1053,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1533,\"y\":3890,\"r\":1,\"color\":\"rgb(255,"
+  "14,7)\"},{\"x\":2282,\"y\":52,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3634,\"y\":1252,\"r\":1,\"color\":\"rgb(255,7"
+  ",139)\"},{\"x\":2554,\"y\":727,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2838,\"y\":873,\"r\":1,\"color\":\"rgb(7,133"
+  ",255)\"},{\"x\":2460,\"y\":4577,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1829,\"y\":2297,\"r\":1,\"color\":\"rgb(255"
+  ",7,139)\"},{\"x\":2255,\"y\":2800,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3397,\"y\":109,\"r\":1,\"color\":\"rgb(25"
+  "5,7,139)\"},{\"x\":351,\"y\":1099,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4088,\"y\":576,\"r\":1,\"color\":\"rgb(25"
+  "5,130,7)\"},{\"x\":506,\"y\":3342,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1879,\"y\":382,\"r\":1,\"color\":\"rgb(255"
+  ",130,7)\"},{\"x\":4989,\"y\":2802,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":253,\"y\":4734,\"r\":1,\"color\":\"rgb(25"
+  "5,14,7)\"},{\"x\":2107,\"y\":100,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":867,\"y\":4023,\"r\":1,\"color\":\"rgb(7,2"
+  "55,171)\"},{\"x\":220,\"y\":448,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2901,\"y\":2679,\"r\":1,\"color\":\"rgb(254"
+  ",255,0)\"},{\"x\":2781,\"y\":1988,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":124,\"y\":4680,\"r\":1,\"color\":\"rgb(7,1"
+  "33,255)\"},{\"x\":3253,\"y\":2400,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4918,\"y\":1726,\"r\":1,\"color\":\"rgb(25"
+  "4,255,0)\"},{\"x\":3497,\"y\":675,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4448,\"y\":1981,\"r\":1,\"color\":\"rgb(2"
+  "54,255,0)\"},{\"x\":2202,\"y\":3781,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":860,\"y\":488,\"r\":1,\"color\":\"rgb(7"
+  ",191,255)\"},{\"x\":2171,\"y\":4287,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1034,\"y\":2604,\"r\":1,\"color\":\"rgb"
+  "(7,133,255)\"},{\"x\":3704,\"y\":1011,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1696,\"y\":2278,\"r\":1,\"color\":\"r"
+  "gb(7,255,171)\"},{\"x\":3524,\"y\":2297,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1339,\"y\":4247,\"r\":1,\"color\":"
+  "\"rgb(7,191,255)\"},{\"x\":1842,\"y\":4810,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3490,\"y\":345,\"r\":1,\"color\""
+  ":\"rgb(205,7,255)\"},{\"x\":852,\"y\":2239,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":938,\"y\":3921,\"r\":1,\"color\":"
+  "\"rgb(205,7,255)\"},{\"x\":1407,\"y\":4321,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":917,\"y\":1953,\"r\":1,\"color\""
+  ":\"rgb(255,14,7)\"},{\"x\":2557,\"y\":2368,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":668,\"y\":664,\"r\":1,\"color\":"
+  "\"rgb(7,133,255)\"},{\"x\":1625,\"y\":1022,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2991,\"y\":3506,\"r\":1,\"color"
+  "\":\"rgb(254,255,0)\"},{\"x\":2528,\"y\":1312,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4554,\"y\":881,\"r\":1,\"colo"
+  "r\":\"rgb(7,255,171)\"},{\"x\":3928,\"y\":773,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3292,\"y\":268,\"r\":1,\"colo"
+  "r\":\"rgb(254,255,0)\"},{\"x\":3396,\"y\":1696,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2695,\"y\":1676,\"r\":1,\"co"
+  "lor\":\"rgb(81,255,7)\"},{\"x\":4247,\"y\":2903,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4279,\"y\":365,\"r\":1,\"co"
+  "lor\":\"rgb(81,255,7)\"},{\"x\":487,\"y\":3226,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1337,\"y\":587,\"r\":1,\"col"
+  "or\":\"rgb(255,7,139)\"},{\"x\":4972,\"y\":2301,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":443,\"y\":4908,\"r\":1,\"co"
+  "lor\":\"rgb(7,133,255)\"},{\"x\":3168,\"y\":395,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3682,\"y\":1338,\"r\":1,\"c"
+  "olor\":\"rgb(7,133,255)\"},{\"x\":3351,\"y\":2702,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1364,\"y\":3818,\"r\":1,"
+  "\"color\":\"rgb(254,255,0)\"},{\"x\":4505,\"y\":385,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1153,\"y\":4244,\"r\":1"
+  ",\"color\":\"rgb(255,14,7)\"},{\"x\":1972,\"y\":3909,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1676,\"y\":1801,\"r\":"
+  "1,\"color\":\"rgb(205,7,255)\"},{\"x\":3705,\"y\":4726,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2449,\"y\":3369,\"r\""
+  ":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2288,\"y\":2339,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3554,\"y\":2619,\""
+  "r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3826,\"y\":1142,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3694,\"y\":430,"
+  "\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":784,\"y\":4411,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4310,\"y\":810,"
+  "\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4275,\"y\":3453,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2289,\"y\":162"
+  "7,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3775,\"y\":2810,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3741,\"y\":4"
+  "947,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1102,\"y\":671,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3093,\"y\":"
+  "4890,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4128,\"y\":1735,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1810,\"y\""
+  ":2880,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1304,\"y\":361,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3673,\"y\""
+  ":2945,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":704,\"y\":3245,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":405,\"y\""
+  ":3887,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1946,\"y\":294,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3380,\"y"
+  "\":4323,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1567,\"y\":4760,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3163,\""
+  "y\":812,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4085,\"y\":2139,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3002,"
+  "\"y\":1990,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2469,\"y\":4131,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":233"
+  "8,\"y\":515,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2129,\"y\":483,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":460"
+  "3,\"y\":1926,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2676,\"y\":3423,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":50"
+  "5,\"y\":4756,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3339,\"y\":4712,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4"
+  "851,\"y\":674,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4770,\"y\":1045,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3"
+  "70,\"y\":4880,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":115,\"y\":4448,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":42"
+  "12,\"y\":195,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":422,\"y\":1737,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":17"
+  "60,\"y\":3101,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3832,\"y\":3819,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":6"
+  "20,\"y\":3340,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":441,\"y\":4709,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":50"
+  "6,\"y\":2212,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":790,\"y\":2785,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":12"
+  "76,\"y\":3668,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":278,\"y\":2311,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2"
+  "09,\"y\":2881,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3566,\"y\":4095,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":"
+  "3076,\"y\":1326,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":901,\"y\":3551,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":"
+  "3672,\"y\":4736,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3102,\"y\":2561,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\""
+  ":4265,\"y\":4476,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3268,\"y\":4713,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\""
+  "x\":2797,\"y\":835,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2548,\"y\":1289,\"r\":1,\"color\":\"rgb(7,191,255)\"},{"
+  "\"x\":784,\"y\":2283,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2618,\"y\":1539,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":4526,\"y\":1722,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":821,\"y\":1976,\"r\":1,\"color\":\"rgb(255,130,7)\"},{"
+  "\"x\":4371,\"y\":244,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1296,\"y\":4831,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":2242,\"y\":1013,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4645,\"y\":359,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":525,\"y\":1914,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3683,\"y\":4895,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":2753,\"y\":3017,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1001,\"y\":2233,\"r\":1,\"color\":\"rgb(81,255,7)\"},{"
+  "\"x\":4917,\"y\":2293,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":978,\"y\":1151,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\""
+  "x\":3848,\"y\":437,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3074,\"y\":3462,\"r\":1,\"color\":\"rgb(255,130,7)\"},{"
+  "\"x\":3581,\"y\":1402,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4705,\"y\":4794,\"r\":1,\"color\":\"rgb(7,133,255)\"},"
+  "{\"x\":4182,\"y\":3793,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2336,\"y\":1144,\"r\":1,\"color\":\"rgb(255,7,139)\""
+  "},{\"x\":1529,\"y\":2293,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2143,\"y\":673,\"r\":1,\"color\":\"rgb(7,191,255)"
+  "\"},{\"x\":1882,\"y\":892,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1271,\"y\":1429,\"r\":1,\"color\":\"rgb(205,7,255"
+  ")\"},{\"x\":1510,\"y\":2591,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2167,\"y\":4785,\"r\":1,\"color\":\"rgb(255,130"
+  ",7)\"},{\"x\":3143,\"y\":3189,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4336,\"y\":2505,\"r\":1,\"color\":\"rgb(7,191"
+  ",255)\"}]}",
+  "{\"type\":\"pellets\",\"start\":800,\"pellets\":[{\"x\":42,\"y\":4226,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3040,\""
+  "y\":2783,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":395,\"y\":2184,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":3517,"
+  "\"y\":3927,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4293,\"y\":2269,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":264"
+  "1,\"y\":4904,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3966,\"y\":4570,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":12"
+  "16,\"y\":2575,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1822,\"y\":3505,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":"
+  "1064,\"y\":426,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1601,\"y\":1683,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":"
+  "3925,\"y\":3811,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1719,\"y\":3115,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x"
+  "\":1166,\"y\":2834,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2646,\"y\":2545,\"r\":1,\"color\":\"rgb(254,255,0)\"},{"
+  "\"x\":1753,\"y\":949,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2245,\"y\":4159,\"r\":1,\"color\":\"rgb(255,14,7)\"},{"
+  "\"x\":4584,\"y\":3489,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1855,\"y\":2269,\"r\":1,\"color\":\"rgb(255,7,139)\"},"
+  "{\"x\":597,\"y\":4320,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":875,\"y\":524,\"r\":1,\"color\":\"rgb(7,191,255)\"},{"
+  "\"x\":216,\"y\":3169,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3243,\"y\":598,\"r\":1,\"color\":\"rgb(254,255,0)\"},{"
+  "\"x\":4088,\"y\":1777,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2370,\"y\":4174,\"r\":1,\"color\":\"rgb(7,133,255)\"}"
+  ",{\"x\":2851,\"y\":1132,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4767,\"y\":2365,\"r\":1,\"color\":\"rgb(255,14,7)\""
+  "},{\"x\":2334,\"y\":3173,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3665,\"y\":3666,\"r\":1,\"color\":\"rgb(254,255,0"
+  ")\"},{\"x\":1547,\"y\":3674,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":131,\"y\":3827,\"r\":1,\"color\":\"rgb(255,14,7"
+  ")\"},{\"x\":1543,\"y\":2172,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2345,\"y\":3601,\"r\":1,\"color\":\"rgb(7,255,17"
+  "1)\"},{\"x\":1123,\"y\":4098,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4670,\"y\":973,\"r\":1,\"color\":\"rgb(254,255"
+  ",0)\"},{\"x\":13,\"y\":1504,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4053,\"y\":3386,\"r\":1,\"color\":\"rgb(7,191,2"
+  "55)\"},{\"x\":2601,\"y\":1511,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":264,\"y\":726,\"r\":1,\"color\":\"rgb(205,7,25"
+  "5)\"},{\"x\":2109,\"y\":1703,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1527,\"y\":4534,\"r\":1,\"color\":\"rgb(255,13"
+  "0,7)\"},{\"x\":4751,\"y\":561,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1516,\"y\":1679,\"r\":1,\"color\":\"rgb(205,7"
+  ",255)\"},{\"x\":3359,\"y\":2059,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2611,\"y\":4594,\"r\":1,\"color\":\"rgb(7,1"
+  "91,255)\"},{\"x\":4291,\"y\":4057,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2160,\"y\":660,\"r\":1,\"color\":\"rgb(254"
+  ",255,0)\"},{\"x\":365,\"y\":1674,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3649,\"y\":675,\"r\":1,\"color\":\"rgb(7,13"
+  "3,255)\"},{\"x\":1370,\"y\":4866,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":848,\"y\":4009,\"r\":1,\"color\":\"rgb(205"
+  ",7,255)\"},{\"x\":3061,\"y\":2828,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4531,\"y\":4897,\"r\":1,\"color\":\"rgb(7"
+  ",255,171)\"},{\"x\":1132,\"y\":2266,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1770,\"y\":4144,\"r\":1,\"color\":\"rgb"
+  "(205,7,255)\"},{\"x\":4415,\"y\":2509,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4167,\"y\":1074,\"r\":1,\"color\":\"r"
+  "gb(7,191,255)\"},{\"x\":2434,\"y\":700,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":4670,\"y\":263,\"r\":1,\"color\":\"r"
+  "gb(7,255,171)\"},{\"x\":4017,\"y\":2023,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3123,\"y\":3491,\"r\":1,\"color\":"
+  "\"rgb(7,133,255)\"},{\"x\":4939,\"y\":1944,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1661,\"y\":2750,\"r\":1,\"color"
+  "\":\"rgb(255,7,139)\"},{\"x\":4299,\"y\":3102,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3873,\"y\":4487,\"r\":1,\"col"
+  "or\":\"rgb(81,255,7)\"},{\"x\":1382,\"y\":3259,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3518,\"y\":439,\"r\":1,\"col"
+  "or\":\"rgb(7,191,255)\"},{\"x\":2152,\"y\":1153,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":373,\"y\":1843,\"r\":1,\"co"
+  "lor\":\"rgb(254,255,0)\"},{\"x\":4071,\"y\":1894,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3931,\"y\":2985,\"r\":1,\""
+  "color\":\"rgb(7,255,171)\"},{\"x\":3354,\"y\":627,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3813,\"y\":2422,\"r\":1,"
+  "\"color\":\"rgb(255,14,7)\"},{\"x\":1182,\"y\":1028,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2914,\"y\":3232,\"r\":1"
+  ",\"color\":\"rgb(7,191,255)\"},{\"x\":3927,\"y\":2093,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":1055,\"y\":4070,\"r\":"
+  "1,\"color\":\"rgb(254,255,0)\"},{\"x\":493,\"y\":3017,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4924,\"y\":954,\"r\":"
+  "1,\"color\":\"rgb(205,7,255)\"},{\"x\":3811,\"y\":2299,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2696,\"y\":865,\"r\""
+  ":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4640,\"y\":909,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1848,\"y\":3316,\"r\""
+  ":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3140,\"y\":4428,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":4662,\"y\":3327,\""
+  "r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2692,\"y\":3735,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3599,\"y\":3550"
+  ",\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3640,\"y\":1439,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":1917,\"y\":82"
+  "7,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":4125,\"y\":4291,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":256,\"y\":265"
+  "7,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":4771,\"y\":1586,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":243,\"y\":31"
+  "93,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":2724,\"y\":2734,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":290,\"y\":1"
+  "535,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2721,\"y\":2579,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":4247,\"y\":"
+  "2551,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":843,\"y\":1415,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4988,\"y\":4"
+  "02,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1770,\"y\":3093,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2239,\"y\":"
+  "2895,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1094,\"y\":1353,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4442,\"y"
+  "\":3444,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3623,\"y\":2819,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1076,"
+  "\"y\":3250,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2140,\"y\":3374,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":462,"
+  "\"y\":4062,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2463,\"y\":921,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4706"
+  ",\"y\":461,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3568,\"y\":2144,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":124"
+  "5,\"y\":3652,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":1416,\"y\":2947,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":2"
+  "533,\"y\":4296,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":1884,\"y\":1043,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":"
+  "4670,\"y\":1026,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1508,\"y\":3827,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x"
+  "\":3251,\"y\":3793,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":897,\"y\":2254,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\""
+  "x\":2371,\"y\":1490,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4272,\"y\":3168,\"r\":1,\"color\":\"rgb(7,133,255)\"},"
+  "{\"x\":2939,\"y\":3869,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3573,\"y\":2613,\"r\":1,\"color\":\"rgb(7,133,255)\""
+  "},{\"x\":4397,\"y\":4813,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3476,\"y\":4646,\"r\":1,\"color\":\"rgb(7,191,255"
+  ")\"},{\"x\":492,\"y\":1814,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1976,\"y\":4348,\"r\":1,\"color\":\"rgb(255,14,7"
+  ")\"},{\"x\":4494,\"y\":1274,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1171,\"y\":441,\"r\":1,\"color\":\"rgb(7,255,17"
+  "1)\"},{\"x\":2545,\"y\":2300,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3553,\"y\":2159,\"r\":1,\"color\":\"rgb(255,14"
+  ",7)\"},{\"x\":4950,\"y\":1067,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2497,\"y\":3407,\"r\":1,\"color\":\"rgb(205,7"
+  ",255)\"},{\"x\":274,\"y\":4651,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4496,\"y\":1400,\"r\":1,\"color\":\"rgb(7,255"
+  ",171)\"},{\"x\":1039,\"y\":2078,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":1073,\"y\":1947,\"r\":1,\"color\":\"rgb(81,"
+  "255,7)\"},{\"x\":4794,\"y\":94,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":438,\"y\":1132,\"r\":1,\"color\":\"rgb(255,7"
+  ",139)\"},{\"x\":1379,\"y\":73,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":2665,\"y\":2058,\"r\":1,\"color\":\"rgb(254,2"
+  "55,0)\"},{\"x\":4452,\"y\":3222,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":3645,\"y\":3577,\"r\":1,\"color\":\"rgb(81,"
+  "255,7)\"},{\"x\":2405,\"y\":2453,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2891,\"y\":991,\"r\":1,\"color\":\"rgb(7,2"
+  "55,171)\"},{\"x\":754,\"y\":4934,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3718,\"y\":1192,\"r\":1,\"color\":\"rgb(255"
+  ",130,7)\"},{\"x\":335,\"y\":660,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":829,\"y\":479,\"r\":1,\"color\":\"rgb(81,255"
+  ",7)\"},{\"x\":2976,\"y\":3689,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":1998,\"y\":2844,\"r\":1,\"color\":\"rgb(255,1"
+  "4,7)\"},{\"x\":2363,\"y\":4494,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":94,\"y\":2128,\"r\":1,\"color\":\"rgb(81,255"
+  ",7)\"},{\"x\":3797,\"y\":225,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":3609,\"y\":112,\"r\":1,\"color\":\"rgb(7,191,25"
+  "5)\"},{\"x\":3453,\"y\":1223,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":4631,\"y\":3875,\"r\":1,\"color\":\"rgb(254,255"
+  ",0)\"},{\"x\":1175,\"y\":3953,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":4894,\"y\":3964,\"r\":1,\"color\":\"rgb(7,133"
+  ",255)\"},{\"x\":3577,\"y\":2464,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":1573,\"y\":2823,\"r\":1,\"color\":\"rgb(7,2"
+  "55,171)\"},{\"x\":2076,\"y\":3228,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":2738,\"y\":2719,\"r\":1,\"color\":\"rgb(25"
+  "5,14,7)\"},{\"x\":2666,\"y\":258,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":871,\"y\":4071,\"r\":1,\"color\":\"rgb(81,"
+  "255,7)\"},{\"x\":4704,\"y\":4740,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":2268,\"y\":814,\"r\":1,\"color\":\"rgb(81,"
+  "255,7)\"},{\"x\":2110,\"y\":1866,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":2435,\"y\":4151,\"r\":1,\"color\":\"rgb(7,1"
+  "91,255)\"},{\"x\":681,\"y\":4936,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":561,\"y\":287,\"r\":1,\"color\":\"rgb(255,"
+  "7,139)\"},{\"x\":659,\"y\":4631,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":1205,\"y\":262,\"r\":1,\"color\":\"rgb(7,25"
+  "5,171)\"},{\"x\":2139,\"y\":338,\"r\":1,\"color\":\"rgb(81,255,7)\"},{\"x\":3197,\"y\":4198,\"r\":1,\"color\":\"rgb(7,19"
+  "1,255)\"},{\"x\":598,\"y\":4694,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":3863,\"y\":1431,\"r\":1,\"color\":\"rgb(255"
+  ",14,7)\"},{\"x\":1195,\"y\":1611,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3440,\"y\":2069,\"r\":1,\"color\":\"rgb(20"
+  "5,7,255)\"},{\"x\":4420,\"y\":2407,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":2207,\"y\":1840,\"r\":1,\"color\":\"rgb("
+  "255,7,139)\"},{\"x\":266,\"y\":2562,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3141,\"y\":763,\"r\":1,\"color\":\"rgb("
+  "255,7,139)\"},{\"x\":1436,\"y\":4917,\"r\":1,\"color\":\"rgb(7,133,255)\"},{\"x\":2121,\"y\":106,\"r\":1,\"color\":\"rgb"
+  "(255,14,7)\"},{\"x\":4293,\"y\":439,\"r\":1,\"color\":\"rgb(255,130,7)\"},{\"x\":3029,\"y\":4594,\"r\":1,\"color\":\"rgb"
+  "(7,255,171)\"},{\"x\":4989,\"y\":4384,\"r\":1,\"color\":\"rgb(254,255,0)\"},{\"x\":3084,\"y\":4470,\"r\":1,\"color\":\"r"
+  "gb(254,255,0)\"},{\"x\":4565,\"y\":3000,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":3992,\"y\":3513,\"r\":1,\"color\":"
+  "\"rgb(205,7,255)\"},{\"x\":2201,\"y\":3052,\"r\":1,\"color\":\"rgb(205,7,255)\"},{\"x\":4655,\"y\":800,\"r\":1,\"color\""
+  ":\"rgb(254,255,0)\"},{\"x\":1647,\"y\":2673,\"r\":1,\"color\":\"rgb(7,191,255)\"},{\"x\":4487,\"y\":2903,\"r\":1,\"colo"
+  "r\":\"rgb(7,191,255)\"},{\"x\":1763,\"y\":940,\"r\":1,\"color\":\"rgb(255,7,139)\"},{\"x\":2070,\"y\":565,\"r\":1,\"colo"
+  "r\":\"rgb(7,191,255)\"},{\"x\":2927,\"y\":926,\"r\":1,\"color\":\"rgb(255,14,7)\"},{\"x\":992,\"y\":781,\"r\":1,\"color\""
+  ":\"rgb(7,191,255)\"},{\"x\":4316,\"y\":3811,\"r\":1,\"color\":\"rgb(7,255,171)\"},{\"x\":3167,\"y\":155,\"r\":1,\"color"
+  "\":\"rgb(255,7,139)\"}]}",
+};
+
+// 4 broadcasts seguidos de 10 jogadores (broadcastGameState)
+const char* const PLAYER_FRAMES[] = {
+  "{\"type\":\"players\",\"players\":{\"4238\":{\"x\":1662.736,\"y\":1099.927,\"r\":77.43671,\"ack\":672,\"name\":\"Ana\",\""
+  "fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"3699\":{\"x\":4306.118,\"y\":1594.586,\"r\":30"
+  ".57886,\"ack\":231,\"name\":\"bruno\",\"fillColor\":\"rgb(255,130,7)\",\"strokeColor\":\"rgb(217,111,6)\"},\"2451\":"
+  "{\"x\":4707.366,\"y\":3475.596,\"r\":25.13667,\"ack\":1266,\"name\":\"Carla_22\",\"fillColor\":\"rgb(7,133,255)\",\"s"
+  "trokeColor\":\"rgb(6,113,217)\"},\"8565\":{\"x\":276.3298,\"y\":1805.124,\"r\":43.73876,\"ack\":995,\"name\":\"xX_Da"
+  "vi_Xx\",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"},\"bot1.1\":{\"x\":443.4015,\"y\":980.852"
+  ",\"r\":70.78654,\"ack\":0,\"name\":\"Bot 1\",\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"b"
+  "ot1.2\":{\"x\":1410.2,\"y\":2429.146,\"r\":50.44501,\"ack\":0,\"name\":\"Bot 2\",\"fillColor\":\"rgb(255,130,7)\",\"st"
+  "rokeColor\":\"rgb(217,111,6)\"},\"bot1.3\":{\"x\":1693.454,\"y\":3515.932,\"r\":69.17337,\"ack\":0,\"name\":\"Bot 3\""
+  ",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"},\"bot1.4\":{\"x\":251.2484,\"y\":304.2698,\"r"
+  "\":63.2098,\"ack\":0,\"name\":\"Bot 4\",\"fillColor\":\"rgb(7,133,255)\",\"strokeColor\":\"rgb(6,113,217)\"},\"bot1."
+  "5\":{\"x\":4771.906,\"y\":1288.874,\"r\":74.52463,\"ack\":0,\"name\":\"Bot 5\",\"fillColor\":\"rgb(255,130,7)\",\"stro"
+  "keColor\":\"rgb(217,111,6)\"},\"bot1.6\":{\"x\":955.7429,\"y\":2147.953,\"r\":75.9186,\"ack\":0,\"name\":\"Bot 6\",\"f"
+  "illColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"}}}",
+  "{\"type\":\"players\",\"players\":{\"4238\":{\"x\":1653.802,\"y\":1108.404,\"r\":77.43671,\"ack\":674,\"name\":\"Ana\",\""
+  "fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"3699\":{\"x\":4284.082,\"y\":1603.38,\"r\":31."
+  "57886,\"ack\":233,\"name\":\"bruno\",\"fillColor\":\"rgb(255,130,7)\",\"strokeColor\":\"rgb(217,111,6)\"},\"2451\":{"
+  "\"x\":4731.756,\"y\":3465.015,\"r\":26.13667,\"ack\":1268,\"name\":\"Carla_22\",\"fillColor\":\"rgb(7,133,255)\",\"st"
+  "rokeColor\":\"rgb(6,113,217)\"},\"8565\":{\"x\":260.5815,\"y\":1794.807,\"r\":44.73876,\"ack\":997,\"name\":\"xX_Dav"
+  "i_Xx\",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"},\"bot1.1\":{\"x\":430.1838,\"y\":980.7891"
+  ",\"r\":70.78654,\"ack\":0,\"name\":\"Bot 1\",\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"b"
+  "ot1.2\":{\"x\":1421.042,\"y\":2442.285,\"r\":50.44501,\"ack\":0,\"name\":\"Bot 2\",\"fillColor\":\"rgb(255,130,7)\",\""
+  "strokeColor\":\"rgb(217,111,6)\"},\"bot1.3\":{\"x\":1706.818,\"y\":3517.515,\"r\":70.17337,\"ack\":0,\"name\":\"Bot "
+  "3\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"},\"bot1.4\":{\"x\":262.6342,\"y\":295.4187,"
+  "\"r\":63.2098,\"ack\":0,\"name\":\"Bot 4\",\"fillColor\":\"rgb(7,133,255)\",\"strokeColor\":\"rgb(6,113,217)\"},\"bot"
+  "1.5\":{\"x\":4763.555,\"y\":1298.436,\"r\":74.72463,\"ack\":0,\"name\":\"Bot 5\",\"fillColor\":\"rgb(255,130,7)\",\"st"
+  "rokeColor\":\"rgb(217,111,6)\"},\"bot1.6\":{\"x\":956.1533,\"y\":2160.457,\"r\":76.9186,\"ack\":0,\"name\":\"Bot 6\","
+  "\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"}}}",
+  "{\"type\":\"players\",\"players\":{\"4238\":{\"x\":1644.868,\"y\":1116.881,\"r\":77.63671,\"ack\":676,\"name\":\"Ana\",\""
+  "fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"3699\":{\"x\":4262.474,\"y\":1612.004,\"r\":31"
+  ".57886,\"ack\":235,\"name\":\"bruno\",\"fillColor\":\"rgb(255,130,7)\",\"strokeColor\":\"rgb(217,111,6)\"},\"2451\":"
+  "{\"x\":4755.617,\"y\":3454.664,\"r\":27.13667,\"ack\":1270,\"name\":\"Carla_22\",\"fillColor\":\"rgb(7,133,255)\",\"s"
+  "trokeColor\":\"rgb(6,113,217)\"},\"8565\":{\"x\":245.0764,\"y\":1784.649,\"r\":45.73876,\"ack\":999,\"name\":\"xX_Da"
+  "vi_Xx\",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"},\"bot1.1\":{\"x\":416.9661,\"y\":980.726"
+  "3,\"r\":70.98654,\"ack\":0,\"name\":\"Bot 1\",\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\""
+  "bot1.2\":{\"x\":1431.884,\"y\":2455.423,\"r\":50.44501,\"ack\":0,\"name\":\"Bot 2\",\"fillColor\":\"rgb(255,130,7)\","
+  "\"strokeColor\":\"rgb(217,111,6)\"},\"bot1.3\":{\"x\":1720.033,\"y\":3519.081,\"r\":70.17337,\"ack\":0,\"name\":\"Bot"
+  " 3\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"},\"bot1.4\":{\"x\":274.0199,\"y\":286.5676"
+  ",\"r\":64.2098,\"ack\":0,\"name\":\"Bot 4\",\"fillColor\":\"rgb(7,133,255)\",\"strokeColor\":\"rgb(6,113,217)\"},\"bo"
+  "t1.5\":{\"x\":4755.222,\"y\":1307.977,\"r\":74.72463,\"ack\":0,\"name\":\"Bot 5\",\"fillColor\":\"rgb(255,130,7)\",\"s"
+  "trokeColor\":\"rgb(217,111,6)\"},\"bot1.6\":{\"x\":956.5594,\"y\":2172.832,\"r\":76.9186,\"ack\":0,\"name\":\"Bot 6\""
+  ",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"}}}",
+  "{\"type\":\"players\",\"players\":{\"4238\":{\"x\":1635.952,\"y\":1125.34,\"r\":78.63671,\"ack\":678,\"name\":\"Ana\",\"f"
+  "illColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\"3699\":{\"x\":4240.866,\"y\":1620.627,\"r\":31."
+  "77886,\"ack\":237,\"name\":\"bruno\",\"fillColor\":\"rgb(255,130,7)\",\"strokeColor\":\"rgb(217,111,6)\"},\"2451\":{"
+  "\"x\":4778.972,\"y\":3444.532,\"r\":27.13667,\"ack\":1272,\"name\":\"Carla_22\",\"fillColor\":\"rgb(7,133,255)\",\"st"
+  "rokeColor\":\"rgb(6,113,217)\"},\"8565\":{\"x\":229.8072,\"y\":1774.646,\"r\":46.73876,\"ack\":1001,\"name\":\"xX_Da"
+  "vi_Xx\",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"},\"bot1.1\":{\"x\":403.7775,\"y\":980.663"
+  "6,\"r\":70.98654,\"ack\":0,\"name\":\"Bot 1\",\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"},\""
+  "bot1.2\":{\"x\":1442.727,\"y\":2468.562,\"r\":50.64501,\"ack\":0,\"name\":\"Bot 2\",\"fillColor\":\"rgb(255,130,7)\","
+  "\"strokeColor\":\"rgb(217,111,6)\"},\"bot1.3\":{\"x\":1733.248,\"y\":3520.648,\"r\":70.17337,\"ack\":0,\"name\":\"Bot"
+  " 3\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"},\"bot1.4\":{\"x\":285.2704,\"y\":277.8217"
+  ",\"r\":64.2098,\"ack\":0,\"name\":\"Bot 4\",\"fillColor\":\"rgb(7,133,255)\",\"strokeColor\":\"rgb(6,113,217)\"},\"bo"
+  "t1.5\":{\"x\":4746.889,\"y\":1317.519,\"r\":75.72463,\"ack\":0,\"name\":\"Bot 5\",\"fillColor\":\"rgb(255,130,7)\",\"s"
+  "trokeColor\":\"rgb(217,111,6)\"},\"bot1.6\":{\"x\":956.9656,\"y\":2185.207,\"r\":76.9186,\"ack\":0,\"name\":\"Bot 6\""
+  ",\"fillColor\":\"rgb(255,14,7)\",\"strokeColor\":\"rgb(217,12,6)\"}}}",
+};
+
+#endif
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Gera frames.h: frames do servidor do agario no formato exato de envio.
+
+Snapshot completo de pellets (MAX_PELLETS 1000 em blocos de PELLET_CHUNK
+200, como writePelletChunk) e snapshots de jogadores de broadcastGameState
+com 10 jogadores (4 humanos, 6 bots) andando entre broadcasts, números em
+float com 7 dígitos como o ArduinoJson. Semente fixa, então rodar de novo
+dá o mesmo arquivo.
+
+    python3 test/test_lzss/gerar_frames.py > test/test_lzss/frames.h
+"""
+
+import math
+import random
+
+random.seed(30)
+
+PELLET_COLORS = [
+    "rgb(255,130,7)", "rgb(255,7,139)", "rgb(254,255,0)",
+    "rgb(7,255,171)", "rgb(255,14,7)", "rgb(81,255,7)",
+    "rgb(7,191,255)", "rgb(7,133,255)", "rgb(205,7,255)",
+]
+NAMES = ["Ana", "bruno", "Carla_22", "xX_Davi_Xx"]
+
+
+def pellet_frames():
+    pellets = [(random.randint(10, 4989), random.randint(10, 4989), 1,
+                random.randrange(len(PELLET_COLORS))) for _ in range(1000)]
+    frames = []
+    for start in range(0, 1000, 200):
+        items = ['{"x":%d,"y":%d,"r":%d,"color":"%s"}' % (x, y, r, PELLET_COLORS[c])
+                 for x, y, r, c in pellets[start:start + 200]]
+        frames.append('{"type":"pellets","start":%d,"pellets":[%s]}' % (start, ",".join(items)))
+    return frames
+
+
+def num(v):
+    return "%.7g" % v
+
+
+def stroke(fill):
+    rgb = [int(c) for c in fill[4:-1].split(",")]
+    return "rgb(%d,%d,%d)" % tuple(int(c * 0.85 + 0.5) for c in rgb)
+
+
+def player_frames():
+    players = []
+    for k in range(10):
+        human = k < 4
+        fill = random.choice(PELLET_COLORS)
+        players.append({
+            "id": str(random.randrange(10000)) if human else "bot1.%d" % (k - 3),
+            "name": NAMES[k] if human else "Bot %d" % (k - 3),
+            "x": random.uniform(100, 4900), "y": random.uniform(100, 4900),
+            "r": random.uniform(20, 90), "ack": random.randrange(2000) if human else 0,
+            "angle": random.uniform(0, 2 * math.pi),
+            "fill": fill, "stroke": stroke(fill),
+        })
+    frames = []
+    for _ in range(4):
+        items = []
+        for p in players:
+            items.append('"%s":{"x":%s,"y":%s,"r":%s,"ack":%d,"name":"%s","fillColor":"%s","strokeColor":"%s"}'
+                         % (p["id"], num(p["x"]), num(p["y"]), num(p["r"]), p["ack"],
+                            p["name"], p["fill"], p["stroke"]))
+            # deslocamento em 100 ms, menor para células maiores
+            speed = 30 * 40 / (p["r"] + 20)
+            p["x"] += math.cos(p["angle"]) * speed
+            p["y"] += math.sin(p["angle"]) * speed
+            p["r"] += random.choice([0, 0, 0.2, 1.0])
+            p["ack"] += 2 if p["ack"] else 0
+        frames.append('{"type":"players","players":{%s}}' % ",".join(items))
+    return frames
+
+
+def literal(text):
+    lines = []
+    for k in range(0, len(text), 100):
+        lines.append('  "%s"' % text[k:k + 100].replace("\\", "\\\\").replace('"', '\\"'))
+    return "\n".join(lines)
+
+
+def table(name, frames):
+    body = ",\n".join(literal(f) for f in frames)
+    return "const char* const %s[] = {\n%s,\n};\n" % (name, body)
+
+
+print("// Frames sintéticos gerados por gerar_frames.py; não editar à mão")
+print("#ifndef FRAMES_H\n#define FRAMES_H\n")
+print("// Snapshot completo de pellets em 5 blocos de 200 (writePelletChunk)")
+print(table("PELLET_FRAMES", pellet_frames()))
+print("// 4 broadcasts seguidos de 10 jogadores (broadcastGameState)")
+print(table("PLAYER_FRAMES", player_frames()))
+print("#endif")
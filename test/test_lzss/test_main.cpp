@@ -0,0 +1,129 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "lzss.h"
+#include "frames.h"
+
+// Compressor dos frames grandes (src/agario/lzss.h) no host: ida e volta
+// pelo mesmo decodificador do cliente, taxa e tempo nos frames de frames.h
+
+#define COUNT(v) (sizeof(v) / sizeof(v[0]))
+#define FRAME_HEADER_SIZE 5   // como no servidor: tipo + tamanho original
+
+static LzssEncoder lzss;
+static uint8_t packed[16 * 1024];
+static uint8_t unpacked[16 * 1024];
+
+// Porta de lzssDecode() da página do jogo
+static void lzssDecode(const uint8_t* src, uint8_t* out, size_t outLen) {
+  size_t o = 0;
+  size_t bitPos = 0;
+  auto bits = [&](int n) {
+    uint32_t v = 0;
+    while (n--) {
+      v = (v << 1) | ((src[bitPos >> 3] >> (7 - (bitPos & 7))) & 1);
+      bitPos++;
+    }
+    return v;
+  };
+  while (o < outLen) {
+    if (bits(1)) {
+      out[o++] = bits(8);
+    } else {
+      size_t dist = bits(LZSS_WINDOW_BITS) + 1;
+      size_t len = bits(LZSS_LENGTH_BITS) + LZSS_MIN_MATCH;
+      for (; len > 0 && o < outLen; len--, o++) out[o] = out[o - dist];
+    }
+  }
+}
+
+// Como broadcastFrame(): saída limitada ao tamanho original menos o cabeçalho
+static size_t compressFrame(const char* frame) {
+  size_t len = strlen(frame);
+  return lzss.compress((const uint8_t*)frame, len, packed, len - FRAME_HEADER_SIZE);
+}
+
+static void checkRoundTrip(const char* frame) {
+  size_t len = strlen(frame);
+  TEST_ASSERT_TRUE(len < sizeof(unpacked));
+  size_t n = compressFrame(frame);
+  TEST_ASSERT_TRUE_MESSAGE(n > 0, "frame não diminuiu");
+  memset(unpacked, 0, sizeof(unpacked));
+  lzssDecode(packed, unpacked, len);
+  TEST_ASSERT_EQUAL_MEMORY(frame, unpacked, len);
+}
+
+// Taxa (saída com cabeçalho / entrada) e tempo médio de compressão
+static void report(const char* name, const char* const* frames, size_t count, double maxRatio) {
+  const int rounds = 200;
+  size_t in = 0, out = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (size_t k = 0; k < count; k++) {
+      size_t n = compressFrame(frames[k]);
+      if (r == 0) {
+        in += strlen(frames[k]);
+        out += n + FRAME_HEADER_SIZE;
+      }
+    }
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()
+              / (rounds * count);
+
+  double ratio = (double)out / in;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "lzss %s: %u -> %u bytes (%.1f%%), %.1f us/frame (%.0f MB/s)",
+           name, (unsigned)in, (unsigned)out, 100 * ratio, us, in / count / us);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(ratio < maxRatio);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_pellets_round_trip() {
+  for (size_t k = 0; k < COUNT(PELLET_FRAMES); k++) checkRoundTrip(PELLET_FRAMES[k]);
+}
+
+void test_players_round_trip() {
+  for (size_t k = 0; k < COUNT(PLAYER_FRAMES); k++) checkRoundTrip(PLAYER_FRAMES[k]);
+}
+
+// Repetições longas e sobrepostas (distância 1) e o fim no meio de um byte
+void test_runs_and_tail() {
+  static char text[3000];
+  memset(text, 'a', 2000);
+  for (int k = 2000; k < 2999; k++) text[k] = "0123456789"[(k * 7) % 10];
+  text[2999] = '\0';
+  checkRoundTrip(text);
+  checkRoundTrip("abcabcabcabcabcabcabcabcabcabcabcabcabcabcabcabcX");
+}
+
+// Bytes aleatórios não cabem no tamanho original: 0, o servidor manda texto
+void test_incompressible() {
+  static uint8_t noise[2048];
+  uint32_t x = 2463534242u;
+  for (size_t k = 0; k < sizeof(noise); k++) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    noise[k] = x;
+  }
+  TEST_ASSERT_EQUAL(0, lzss.compress(noise, sizeof(noise), packed, sizeof(noise) - FRAME_HEADER_SIZE));
+}
+
+void test_ratio_and_time() {
+  report("pellets", PELLET_FRAMES, COUNT(PELLET_FRAMES), 0.30);
+  report("players", PLAYER_FRAMES, COUNT(PLAYER_FRAMES), 0.55);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_pellets_round_trip);
+  RUN_TEST(test_players_round_trip);
+  RUN_TEST(test_runs_and_tail);
+  RUN_TEST(test_incompressible);
+  RUN_TEST(test_ratio_and_time);
+  return UNITY_END();
+}
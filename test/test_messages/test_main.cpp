@@ -0,0 +1,151 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <ArduinoJson.h>
+#include "arena.h"
+#include "messages.h"
+
+// Tratamento das mensagens dos clientes (src/agario/messages.h) no host,
+// e o parser de agora contra o de antes, na mesma arena:
+//   - antes: documento inteiro sem filtro, String type = doc["type"]
+//     (cópia no heap) e comparação de String com cada tipo
+//   - agora: limite de tamanho, parse com o filtro, parseMessageType()
+
+#define TICK_ARENA_SIZE 8192
+#define MAX_MESSAGE_SIZE 512
+
+static uint8_t arenaBuffer[TICK_ARENA_SIZE * sizeof(void*) / 4];
+static TickArena arena(arenaBuffer, sizeof(arenaBuffer));
+static JsonDocument inputFilter;
+static volatile float sink;
+
+// String do Arduino: sempre uma cópia no heap
+static MessageType oldParse(const uint8_t* payload, size_t length) {
+  ArenaScope scope(arena);
+  JsonDocument doc(&arena);
+  deserializeJson(doc, payload, length);
+
+  const char* raw = doc["type"] | "";
+  char* type = (char*)malloc(strlen(raw) + 1);
+  strcpy(type, raw);
+  MessageType result = MSG_UNKNOWN;
+  if (strcmp(type, "join") == 0) {
+    result = MSG_JOIN;
+    sink = strlen(doc["name"] | "");
+  } else if (strcmp(type, "input") == 0) {
+    result = MSG_INPUT;
+    sink = doc["mx"].as<float>() + doc["my"].as<float>();
+  }
+  free(type);
+  return result;
+}
+
+static MessageType newParse(const uint8_t* payload, size_t length) {
+  if (length > MAX_MESSAGE_SIZE) return MSG_UNKNOWN;
+  ArenaScope scope(arena);
+  JsonDocument doc(&arena);
+  if (deserializeJson(doc, payload, length, DeserializationOption::Filter(inputFilter))) {
+    return MSG_UNKNOWN;
+  }
+  MessageType result = parseMessageType(doc["type"]);
+  if (result == MSG_JOIN) sink = strlen(doc["name"] | "");
+  else if (result == MSG_INPUT) sink = doc["mx"].as<float>() + doc["my"].as<float>();
+  return result;
+}
+
+// Tráfego de uma sessão: inputs do cliente, um join, tipos desconhecidos,
+// um input com chaves a mais e uma mensagem enorme
+static char messages[8][2048];
+static size_t lengths[8];
+
+static void buildMessages() {
+  const char* base[] = {
+    "{\"type\":\"input\",\"playerId\":\"4238\",\"seq\":1812,\"mx\":0.7071,\"my\":-0.7071,\"dt\":0.016}",
+    "{\"type\":\"input\",\"playerId\":\"4238\",\"seq\":1813,\"mx\":0.5,\"my\":0.866,\"dt\":0.017}",
+    "{\"type\":\"input\",\"playerId\":\"4238\",\"seq\":1814,\"mx\":-1,\"my\":0,\"dt\":0.016}",
+    "{\"type\":\"join\",\"playerId\":\"4238\",\"name\":\"xX_Davi_Xx\",\"fillColor\":\"rgb(255,7,139)\","
+    "\"strokeColor\":\"rgb(217,6,118)\"}",
+    "{\"type\":\"chat\",\"text\":\"oi\"}",
+    "{\"type\":\"input\",\"playerId\":\"4238\",\"seq\":1815,\"mx\":0.1,\"my\":0.2,\"dt\":0.016,"
+    "\"debug\":{\"fps\":59.9,\"ping\":[12,14,13,15,12,11,13],\"ua\":\"Mozilla/5.0 (X11; Linux x86_64)\"}}",
+    "{\"type\":\"input\",\"playerId\":\"4238\",\"seq\":1816,\"mx\":0,\"my\":1,\"dt\":0.016}",
+  };
+  for (int k = 0; k < 7; k++) {
+    strcpy(messages[k], base[k]);
+    lengths[k] = strlen(base[k]);
+  }
+  // Acima de MAX_MESSAGE_SIZE: agora nem chega ao parser
+  size_t n = sprintf(messages[7], "{\"type\":\"input\",\"pad\":\"");
+  memset(messages[7] + n, 'x', 1500);
+  n += 1500;
+  n += sprintf(messages[7] + n, "\",\"mx\":0,\"my\":0}");
+  lengths[7] = n;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_message_type() {
+  TEST_ASSERT_EQUAL(MSG_JOIN, parseMessageType("join"));
+  TEST_ASSERT_EQUAL(MSG_INPUT, parseMessageType("input"));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, parseMessageType("joins"));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, parseMessageType("inp"));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, parseMessageType("Input"));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, parseMessageType(""));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, parseMessageType(NULL));
+}
+
+// Os dois caminhos classificam igual, fora a mensagem grande demais
+void test_same_dispatch() {
+  buildInputFilter(inputFilter);
+  buildMessages();
+  for (int k = 0; k < 7; k++) {
+    TEST_ASSERT_EQUAL(oldParse((uint8_t*)messages[k], lengths[k]), newParse((uint8_t*)messages[k], lengths[k]));
+  }
+  TEST_ASSERT_EQUAL(MSG_INPUT, oldParse((uint8_t*)messages[7], lengths[7]));
+  TEST_ASSERT_EQUAL(MSG_UNKNOWN, newParse((uint8_t*)messages[7], lengths[7]));
+}
+
+static void measure(const char* name, MessageType (*parse)(const uint8_t*, size_t)) {
+  const int rounds = 50000;
+  size_t peak = 0;
+  for (int k = 0; k < 8; k++) {
+    arena.reset();
+    arena.clearStats();
+    parse((uint8_t*)messages[k], lengths[k]);
+    if (arena.highWater() > peak) peak = arena.highWater();
+  }
+
+  // Proporção de uma sessão: 7 de 8 mensagens são do tamanho normal
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (int k = 0; k < 8; k++) parse((uint8_t*)messages[k], lengths[k]);
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()
+              / (rounds * 8.0);
+
+  arena.reset();
+  arena.clearStats();
+  parse((uint8_t*)messages[0], lengths[0]);
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%s: %.2f us/msg (~%.0f msgs/s), arena: input %u B, pico %u B",
+           name, us, 1e6 / us, (unsigned)arena.highWater(), (unsigned)peak);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_EQUAL_UINT32(0, arena.failures());
+  // Sem alocação nenhuma o parse não aconteceu (ArduinoJson de mentira)
+  TEST_ASSERT_TRUE(peak > 0);
+}
+
+void test_old_vs_new() {
+  measure("antes (sem filtro, String)", oldParse);
+  measure("agora (limite, filtro, enum)", newParse);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_message_type);
+  RUN_TEST(test_same_dispatch);
+  RUN_TEST(test_old_vs_new);
+  return UNITY_END();
+}
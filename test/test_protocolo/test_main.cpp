@@ -0,0 +1,192 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "protocolo.h"
+
+// Enlace Arduino <-> ESP32 (include/protocolo.h) rodando no host
+
+static size_t quadroSensores(uint8_t* buf, uint8_t seq, uint16_t distCm) {
+  PayloadSensores p;
+  memset(&p, 0, sizeof(p));
+  p.instante = 1000UL + seq;
+  p.distCm = distCm;
+  p.ldr = 512;
+  p.umidade = 655;
+  p.temperatura = -12;
+  p.flags = SENSOR_DHT_VALIDO;
+  return montarQuadro(buf, QUADRO_SENSORES, seq, &p, sizeof(p));
+}
+
+// Quantos quadros válidos saem de n bytes
+static int alimentar(Decodificador& d, const uint8_t* buf, size_t n) {
+  int quadros = 0;
+  for (size_t k = 0; k < n; k++) {
+    if (d.receber(buf[k])) quadros++;
+  }
+  return quadros;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_ida_e_volta() {
+  uint8_t buf[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  size_t n = quadroSensores(buf, 7, 123);
+  TEST_ASSERT_EQUAL(PROTO_OVERHEAD + sizeof(PayloadSensores), n);
+
+  Decodificador d;
+  TEST_ASSERT_EQUAL(1, alimentar(d, buf, n));
+  TEST_ASSERT_EQUAL_UINT8(QUADRO_SENSORES, d.tipo());
+  TEST_ASSERT_EQUAL_UINT8(7, d.seq());
+
+  PayloadSensores p;
+  TEST_ASSERT_TRUE(d.ler(&p, sizeof(p)));
+  TEST_ASSERT_EQUAL_UINT16(123, p.distCm);
+  TEST_ASSERT_EQUAL_INT16(-12, p.temperatura);
+  TEST_ASSERT_EQUAL_UINT32(1007, p.instante);
+
+  PayloadEstado e;
+  TEST_ASSERT_FALSE(d.ler(&e, sizeof(e)));   // tamanho de outro tipo
+  TEST_ASSERT_EQUAL_UINT32(1, d.recebidos);
+  TEST_ASSERT_EQUAL_UINT32(0, d.erros);
+}
+
+void test_payload_vazio() {
+  uint8_t buf[PROTO_OVERHEAD];
+  size_t n = montarQuadro(buf, QUADRO_ESTADO, 0, NULL, 0);
+  Decodificador d;
+  TEST_ASSERT_EQUAL(1, alimentar(d, buf, n));
+  TEST_ASSERT_EQUAL_UINT8(0, d.tamanho());
+}
+
+// CRC-16/CCITT-FALSE: "123456789" dá 0x29B1
+void test_crc_referencia() {
+  const char* texto = "123456789";
+  uint16_t crc = 0xFFFF;
+  for (const char* c = texto; *c; c++) crc = crc16Update(crc, *c);
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, crc);
+}
+
+// Qualquer bit trocado depois do SYNC derruba o quadro, e o seguinte passa
+void test_crc_corrompido() {
+  uint8_t buf[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  uint8_t bom[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  size_t n = quadroSensores(buf, 1, 40);
+  size_t nBom = quadroSensores(bom, 2, 41);
+
+  for (size_t byte = 1; byte < n; byte++) {
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      uint8_t ruim[sizeof(buf)];
+      memcpy(ruim, buf, n);
+      ruim[byte] ^= 1 << bit;
+
+      Decodificador d;
+      TEST_ASSERT_EQUAL_MESSAGE(0, alimentar(d, ruim, n), "corrupção não detectada");
+
+      // Um len corrompido pode deixar o decodificador esperando bytes e
+      // engolir o quadro seguinte; o outro depois dele tem que passar
+      int quadros = alimentar(d, bom, nBom);
+      quadros += alimentar(d, bom, nBom);
+      TEST_ASSERT_TRUE_MESSAGE(quadros >= 1, "não ressincronizou depois da corrupção");
+
+      PayloadSensores p;
+      TEST_ASSERT_TRUE(d.ler(&p, sizeof(p)));
+      TEST_ASSERT_EQUAL_UINT16(41, p.distCm);
+    }
+  }
+}
+
+void test_len_invalido() {
+  const uint8_t ruim[] = { PROTO_SYNC, QUADRO_SENSORES, 0, PROTO_MAX_PAYLOAD + 1 };
+  Decodificador d;
+  TEST_ASSERT_EQUAL(0, alimentar(d, ruim, sizeof(ruim)));
+  TEST_ASSERT_EQUAL_UINT32(1, d.erros);
+}
+
+// Lixo (inclusive bytes iguais ao SYNC) antes e entre quadros
+void test_ressincroniza_depois_de_lixo() {
+  uint8_t fluxo[256];
+  size_t n = 0;
+  const uint8_t lixo[] = { 0x00, 0xFF, 0x13, PROTO_SYNC, 0x42, 0x10, 0x99, 0x7E };
+  memcpy(fluxo + n, lixo, sizeof(lixo));
+  n += sizeof(lixo);
+  for (uint8_t seq = 0; seq < 5; seq++) {
+    n += quadroSensores(fluxo + n, seq, 100 + seq);
+    fluxo[n++] = 0x55;   // um byte de lixo entre quadros
+  }
+
+  Decodificador d;
+  int quadros = alimentar(d, fluxo, n);
+  // O SYNC falso pode engolir o começo do primeiro quadro; os outros passam
+  TEST_ASSERT_GREATER_OR_EQUAL(4, quadros);
+  TEST_ASSERT_GREATER_THAN(0, d.descartados);
+
+  PayloadSensores p;
+  TEST_ASSERT_TRUE(d.ler(&p, sizeof(p)));
+  TEST_ASSERT_EQUAL_UINT16(104, p.distCm);
+}
+
+void test_buraco_na_sequencia() {
+  uint8_t buf[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  Decodificador d;
+  const uint8_t seqs[] = { 10, 11, 14, 15, 20 };   // faltam 12, 13 e 16..19
+  for (size_t k = 0; k < sizeof(seqs); k++) {
+    size_t n = quadroSensores(buf, seqs[k], 50);
+    TEST_ASSERT_EQUAL(1, alimentar(d, buf, n));
+  }
+  TEST_ASSERT_EQUAL_UINT32(6, d.perdidos);
+  TEST_ASSERT_EQUAL_UINT32(5, d.recebidos);
+}
+
+void test_sequencia_vira_e_por_tipo() {
+  uint8_t buf[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  Decodificador d;
+  alimentar(d, buf, quadroSensores(buf, 254, 1));
+  alimentar(d, buf, quadroSensores(buf, 255, 1));
+  alimentar(d, buf, quadroSensores(buf, 0, 1));   // 255 -> 0 não é perda
+
+  // Outro tipo tem a própria sequência
+  PayloadEstado e;
+  memset(&e, 0, sizeof(e));
+  alimentar(d, buf, montarQuadro(buf, QUADRO_ESTADO, 77, &e, sizeof(e)));
+  alimentar(d, buf, quadroSensores(buf, 1, 1));
+  TEST_ASSERT_EQUAL_UINT32(0, d.perdidos);
+}
+
+// Montar e decodificar; no ESP32 o enlace leva ~720 quadros/s a 115200
+void test_vazao() {
+  const int quadros = 200000;
+  uint8_t buf[PROTO_OVERHEAD + PROTO_MAX_PAYLOAD];
+  Decodificador d;
+
+  auto inicio = std::chrono::steady_clock::now();
+  int ok = 0;
+  for (int k = 0; k < quadros; k++) {
+    size_t n = quadroSensores(buf, (uint8_t)k, (uint16_t)k);
+    ok += alimentar(d, buf, n);
+  }
+  double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+  TEST_ASSERT_EQUAL(quadros, ok);
+  TEST_ASSERT_EQUAL_UINT32(0, d.perdidos);
+  double porSegundo = quadros / s;
+  char msg[96];
+  snprintf(msg, sizeof(msg), "protocolo: %.0f quadros/s (%.1f MB/s) montando e decodificando",
+           porSegundo, porSegundo * (PROTO_OVERHEAD + sizeof(PayloadSensores)) / 1e6);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_GREATER_THAN((long)(PROTO_BAUD / 10 / (PROTO_OVERHEAD + sizeof(PayloadSensores))), (long)porSegundo);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ida_e_volta);
+  RUN_TEST(test_payload_vazio);
+  RUN_TEST(test_crc_referencia);
+  RUN_TEST(test_crc_corrompido);
+  RUN_TEST(test_len_invalido);
+  RUN_TEST(test_ressincroniza_depois_de_lixo);
+  RUN_TEST(test_buraco_na_sequencia);
+  RUN_TEST(test_sequencia_vira_e_por_tipo);
+  RUN_TEST(test_vazao);
+  return UNITY_END();
+}
@@ -0,0 +1,219 @@
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "recording.h"
+
+// Gravação de sessões do agario (src/agario/recording.h) no host: uma
+// sessão gerada com o tráfego que o servidor grava (connect, inputs a cada
+// quadro do navegador, pongs, ticks a 20/s), escrita como recordEvent()
+// faz e lida de volta em pedaços, como a reprodução lê do SPIFFS.
+
+#define TICK_MS 50
+#define RECORD_BUFFER_SIZE 2048
+#define RECORD_MAX_BYTES (512 * 1024)
+#define SESSION_SECONDS 60
+#define HUMANS 4
+
+struct Event {
+  uint32_t time;
+  uint8_t type;
+  uint8_t client;
+  char payload[RECORDING_MAX_PAYLOAD];
+  uint16_t length;
+};
+
+static std::vector<Event> events;
+static std::vector<uint8_t> file;
+
+static uint32_t rng = 7;
+static uint32_t next() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static void add(uint32_t time, uint8_t type, uint8_t client, const void* payload, size_t length) {
+  Event e;
+  e.time = time;
+  e.type = type;
+  e.client = client;
+  e.length = length;
+  memcpy(e.payload, payload, length);
+  events.push_back(e);
+}
+
+// Em ordem de tempo: ticks a cada 50 ms, cada humano manda um input por
+// quadro (~60 Hz, JSON.stringify com doubles inteiros) e um pong por segundo
+static void buildSession() {
+  events.clear();
+  for (int c = 0; c < HUMANS; c++) {
+    char join[160];
+    int n = snprintf(join, sizeof(join),
+                     "{\"type\":\"join\",\"playerId\":\"%u\",\"name\":\"Jogador %d\","
+                     "\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"}",
+                     (unsigned)(next() % 10000), c);
+    add(c * 3, REC_CONNECTED, c, NULL, 0);
+    add(c * 3 + 1, REC_TEXT, c, join, n);
+  }
+
+  uint32_t seq[HUMANS] = {0};
+  double frameAt[HUMANS] = {20, 24, 28, 31};
+  for (uint32_t t = 20; t < SESSION_SECONDS * 1000; t++) {
+    if (t % TICK_MS == 0) {
+      uint8_t thinks = 1 + (t / TICK_MS) % 2;   // 6 bots a cada 200 ms: 1,5 por tick
+      add(t, REC_TICK, 0, &thinks, 1);
+    }
+    for (int c = 0; c < HUMANS; c++) {
+      if (t % 1000 == (uint32_t)(100 + c)) {
+        uint16_t rtt = 20 + next() % 60;
+        uint8_t le[2] = { (uint8_t)rtt, (uint8_t)(rtt >> 8) };
+        add(t, REC_PONG, c, le, 2);
+      }
+      if (t < frameAt[c]) continue;
+      double dt = 0.0166 + (next() % 20) / 10000.0;
+      frameAt[c] += dt * 1000;
+      double angle = (next() % 62832) / 10000.0;
+      char input[200];
+      int n = snprintf(input, sizeof(input),
+                       "{\"type\":\"input\",\"playerId\":\"%d\",\"seq\":%u,\"mx\":%.17g,\"my\":%.17g,\"dt\":%.17g}",
+                       4238 + c, (unsigned)++seq[c], cos(angle), sin(angle), dt);
+      add(t, REC_TEXT, c, input, n);
+    }
+  }
+  add(SESSION_SECONDS * 1000, REC_DISCONNECTED, 0, NULL, 0);
+}
+
+// Como recordEvent()/flushRecording(): buffer fixo esvaziado no "arquivo"
+static size_t writeSession(uint32_t seed) {
+  static uint8_t buffer[RECORD_BUFFER_SIZE];
+  RecordingWriter writer(buffer, sizeof(buffer));
+  file.clear();
+  writer.writeHeader(seed);
+  for (size_t k = 0; k < events.size(); k++) {
+    const Event& e = events[k];
+    if (writer.remaining() < RecordingWriter::maxEventSize(e.length)) {
+      file.insert(file.end(), writer.data(), writer.data() + writer.length());
+      writer.clear();
+    }
+    TEST_ASSERT_TRUE(writer.append(e.time, e.type, e.client, (const uint8_t*)e.payload, e.length));
+  }
+  file.insert(file.end(), writer.data(), writer.data() + writer.length());
+  return file.size();
+}
+
+// Fonte que devolve pedaços de tamanho variável, como File::read()
+struct Source {
+  size_t pos;
+  size_t limit;
+};
+
+static size_t readChunk(void* ctx, uint8_t* buf, size_t n) {
+  Source* s = (Source*)ctx;
+  size_t want = 1 + (s->pos * 7919) % n;
+  size_t left = s->limit - s->pos;
+  size_t take = want < left ? want : left;
+  memcpy(buf, file.data() + s->pos, take);
+  s->pos += take;
+  return take;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_round_trip() {
+  buildSession();
+  writeSession(0xC0FFEE);
+
+  Source source = { 0, file.size() };
+  RecordingReader reader(readChunk, &source);
+  TEST_ASSERT_TRUE(reader.readHeader());
+  TEST_ASSERT_EQUAL_UINT32(0xC0FFEE, reader.seed());
+
+  RecordedEvent e;
+  size_t k = 0;
+  while (reader.next(e)) {
+    TEST_ASSERT_TRUE(k < events.size());
+    TEST_ASSERT_EQUAL_UINT32(events[k].time, e.time);
+    TEST_ASSERT_EQUAL_UINT8(events[k].type, e.type);
+    TEST_ASSERT_EQUAL_UINT8(events[k].client, e.client);
+    TEST_ASSERT_EQUAL_UINT16(events[k].length, e.length);
+    if (e.length) TEST_ASSERT_EQUAL_MEMORY(events[k].payload, e.payload, e.length);
+    k++;
+  }
+  TEST_ASSERT_EQUAL(events.size(), k);
+}
+
+// Arquivo cortado no meio de um evento: para no último inteiro
+void test_truncated() {
+  buildSession();
+  writeSession(1);
+  Source source = { 0, file.size() - 3 };
+  RecordingReader reader(readChunk, &source);
+  TEST_ASSERT_TRUE(reader.readHeader());
+  RecordedEvent e;
+  size_t k = 0;
+  while (reader.next(e)) k++;
+  TEST_ASSERT_EQUAL(events.size() - 1, k);
+}
+
+void test_bad_header_and_payload() {
+  uint8_t buffer[64];
+  RecordingWriter writer(buffer, sizeof(buffer));
+  writer.writeHeader(5);
+  uint8_t big[RECORDING_MAX_PAYLOAD + 1] = {0};
+  TEST_ASSERT_FALSE(writer.append(10, REC_TEXT, 0, big, sizeof(big)));
+
+  file.assign(buffer, buffer + writer.length());
+  file[0] = 'X';
+  Source source = { 0, file.size() };
+  RecordingReader reader(readChunk, &source);
+  TEST_ASSERT_FALSE(reader.readHeader());
+}
+
+// Tamanho por minuto de sessão (RECORD_MAX_BYTES limita a gravação) e
+// custo de ler cada evento, que entra no tempo da reprodução
+void test_size_and_read_cost() {
+  buildSession();
+  size_t bytes = writeSession(1);
+  size_t ticks = 0, inputs = 0, payload = 0;
+  for (size_t k = 0; k < events.size(); k++) {
+    ticks += events[k].type == REC_TICK;
+    inputs += events[k].type == REC_TEXT;
+    payload += events[k].length;
+  }
+
+  const int rounds = 20;
+  size_t read = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    Source source = { 0, file.size() };
+    RecordingReader reader(readChunk, &source);
+    reader.readHeader();
+    RecordedEvent e;
+    while (reader.next(e)) read++;
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / read;
+
+  double perMinute = bytes * 60.0 / SESSION_SECONDS;
+  char msg[200];
+  snprintf(msg, sizeof(msg),
+           "gravação: %u humanos, %u s, %u eventos (%u ticks, %u mensagens), %u bytes (%.1f%% de overhead), "
+           "%.0f KB/min, limite de %u KB em %.0f s; leitura %.0f ns/evento",
+           HUMANS, SESSION_SECONDS, (unsigned)events.size(), (unsigned)ticks, (unsigned)inputs,
+           (unsigned)bytes, 100.0 * (bytes - payload) / bytes, perMinute / 1024,
+           RECORD_MAX_BYTES / 1024, RECORD_MAX_BYTES / perMinute * 60, ns);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_EQUAL(SESSION_SECONDS * 1000 / TICK_MS - 1, ticks);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_truncated);
+  RUN_TEST(test_bad_header_and_payload);
+  RUN_TEST(test_size_and_read_cost);
+  return UNITY_END();
+}
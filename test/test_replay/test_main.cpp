@@ -0,0 +1,361 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "world.h"
+#include "broadcast.h"
+#include "replay.h"
+
+// Reprodução de sessões do agario no host (src/agario/replay.h): o mesmo
+// World e o mesmo Broadcaster do servidor, alimentados por uma gravação
+// no formato de recording.h, o mais rápido possível.
+//   - determinismo: uma sessão "ao vivo" (bots no orçamento de tempo)
+//     gravada e reproduzida num mundo novo termina no mesmo estado
+//   - percentis do tick (World::tick) e do broadcast numa sessão longa
+//   - AGARIO_REPLAY=arquivo reproduz uma gravação baixada de /record
+
+#define RECORD_BUFFER_SIZE 2048
+#define TICK_ARENA_SIZE 8192
+#define SESSION_SECONDS 600
+#define HUMANS 4
+
+// Relógio do jogo controlado pelo teste; relógio de parede para os tempos
+static unsigned long gameClock = 0;
+static unsigned long clockNow() { return gameClock; }
+static unsigned long wallMicros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Relógio de parede lento (1 ms por leitura): o orçamento dos bots corta
+// as decisões ao vivo, e a reprodução só acerta se seguir a contagem gravada
+static unsigned long slowMicros() {
+  static unsigned long t = 0;
+  return t += 1000;
+}
+
+static unsigned long (*liveMicros)() = wallMicros;
+
+static uint8_t arenaBuffer[TICK_ARENA_SIZE];
+static TickArena arena(arenaBuffer, TICK_ARENA_SIZE);
+static JsonDocument filter;
+static World live;
+static World replayed;
+static Broadcaster broadcaster(replayed, arena);
+static std::vector<uint8_t> file;
+
+// Avisos do mundo reproduzido saem pelo broadcaster, como no servidor
+static void onPlayerEaten(int eaten, const char* eaterId, const char* eaterName) {
+  broadcaster.playerEaten(eaten, eaterId, eaterName);
+}
+
+static void onPlayerLeft(int i) {
+  broadcaster.playerLeft(i);
+}
+
+static uint32_t rng = 11;
+static uint32_t next() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static void setupWorld(World& world, uint32_t seed) {
+  world.hooks.clock = clockNow;
+  world.hooks.micros = wallMicros;
+  gameClock = 0;
+  world.reset(seed);
+}
+
+// Como recordEvent()/flushRecording(): buffer fixo esvaziado no "arquivo"
+struct Recorder {
+  uint8_t buffer[RECORD_BUFFER_SIZE];
+  RecordingWriter writer;
+
+  Recorder() : writer(buffer, sizeof(buffer)) {}
+
+  void begin(uint32_t seed) {
+    file.clear();
+    writer.clear();
+    writer.writeHeader(seed);
+  }
+
+  void append(uint8_t type, uint8_t client, const void* payload, size_t length) {
+    if (writer.remaining() < RecordingWriter::maxEventSize(length)) flush();
+    writer.append(gameClock, type, client, (const uint8_t*)payload, length);
+  }
+
+  void flush() {
+    file.insert(file.end(), writer.data(), writer.data() + writer.length());
+    writer.clear();
+  }
+};
+
+static Recorder recorder;
+
+// Servidor ao vivo: grava o evento e o aplica, como webSocketEvent() faz
+// no ESP32
+static void liveEvent(uint8_t type, uint8_t client, const void* payload, size_t length) {
+  recorder.append(type, client, payload, length);
+  RecordedEvent event = { (uint32_t)gameClock, type, client, (uint16_t)length, (const uint8_t*)payload };
+  replayEvent(live, arena, filter, event);
+}
+
+static void liveText(uint8_t client, const char* text) {
+  liveEvent(REC_TEXT, client, text, strlen(text));
+}
+
+// Tick ao vivo: bots no orçamento de tempo e a contagem gravada no REC_TICK
+static void liveTick() {
+  arena.reset();
+  uint8_t thinks = live.tick(-1);
+  recorder.append(REC_TICK, 0, &thinks, sizeof(thinks));
+  live.reapIdlePlayers();
+}
+
+// Humanos simulados: cada um anda até um ponto sorteado e sorteia outro
+// ao chegar (ou a cada 5 s); inputs a ~60 Hz, pong a cada segundo. No meio
+// da sessão um deles cai e volta noutra conexão.
+static void runLiveSession(uint32_t seed, int seconds) {
+  setupWorld(live, seed);
+  live.hooks.micros = liveMicros;
+  recorder.begin(seed);
+
+  struct Human {
+    uint8_t num;
+    uint32_t seq;
+    double nextFrame;
+    float tx, ty;
+    uint32_t retarget;
+  } humans[HUMANS];
+
+  for (int c = 0; c < HUMANS; c++) {
+    char join[160];
+    humans[c].num = c;
+    humans[c].seq = 0;
+    humans[c].nextFrame = 20 + c * 4;
+    humans[c].tx = 0;
+    humans[c].ty = 0;
+    humans[c].retarget = 0;
+    gameClock = c * 3;
+    liveEvent(REC_CONNECTED, c, NULL, 0);
+    snprintf(join, sizeof(join),
+             "{\"type\":\"join\",\"playerId\":\"%u\",\"name\":\"Jogador %d\","
+             "\"fillColor\":\"rgb(255,7,139)\",\"strokeColor\":\"rgb(217,6,118)\"}",
+             (unsigned)(next() % 10000), c);
+    liveText(c, join);
+  }
+
+  for (uint32_t t = 20; t < (uint32_t)seconds * 1000; t++) {
+    gameClock = t;
+    if (t % TICK_MS == 0) liveTick();
+
+    // Queda e reconexão do humano 0 aos 40% da sessão
+    if (t == (uint32_t)seconds * 400) {
+      liveEvent(REC_DISCONNECTED, humans[0].num, NULL, 0);
+      humans[0].num = HUMANS;
+      humans[0].seq = 0;
+      liveEvent(REC_CONNECTED, humans[0].num, NULL, 0);
+      liveText(humans[0].num, "{\"type\":\"join\",\"playerId\":\"9999\",\"name\":\"Volta\","
+                              "\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"}");
+    }
+
+    for (int c = 0; c < HUMANS; c++) {
+      Human& h = humans[c];
+      if (t % 1000 == (uint32_t)(100 + c)) {
+        uint16_t rtt = 20 + next() % 60;
+        uint8_t le[2] = { (uint8_t)rtt, (uint8_t)(rtt >> 8) };
+        liveEvent(REC_PONG, h.num, le, 2);
+      }
+      if (t < h.nextFrame) continue;
+      double dt = 0.0166 + (next() % 20) / 10000.0;
+      h.nextFrame += dt * 1000;
+
+      int i = live.findClient(h.num);
+      if (i < 0) continue;
+      float dx = h.tx - live.players[i].x;
+      float dy = h.ty - live.players[i].y;
+      if (t >= h.retarget || dx * dx + dy * dy < 400) {
+        h.tx = 100 + next() % (WORLD_SIZE - 200);
+        h.ty = 100 + next() % (WORLD_SIZE - 200);
+        h.retarget = t + 5000;
+        dx = h.tx - live.players[i].x;
+        dy = h.ty - live.players[i].y;
+      }
+      double len = sqrt(dx * dx + dy * dy);
+      char input[200];
+      snprintf(input, sizeof(input),
+               "{\"type\":\"input\",\"playerId\":\"x\",\"seq\":%u,\"mx\":%.17g,\"my\":%.17g,\"dt\":%.17g}",
+               (unsigned)++h.seq, len > 0 ? dx / len : 0.0, len > 0 ? dy / len : 0.0, dt);
+      liveText(h.num, input);
+    }
+  }
+  recorder.flush();
+}
+
+struct FileSource {
+  const std::vector<uint8_t>* data;
+  size_t pos;
+};
+
+static size_t readFile(void* ctx, uint8_t* buf, size_t n) {
+  FileSource* s = (FileSource*)ctx;
+  size_t take = std::min(n, s->data->size() - s->pos);
+  memcpy(buf, s->data->data() + s->pos, take);
+  s->pos += take;
+  return take;
+}
+
+struct ReplayTimes {
+  std::vector<uint32_t> tick;
+  std::vector<uint32_t> broadcast;
+  uint32_t events;
+  uint32_t sessionMs;
+  double wallMs;
+};
+
+// Reproduzir 'data' no mundo 'replayed', medindo cada tick e cada broadcast
+static bool replayFile(const std::vector<uint8_t>& data, ReplayTimes& times) {
+  FileSource source = { &data, 0 };
+  RecordingReader reader(readFile, &source);
+  if (!reader.readHeader()) return false;
+
+  setupWorld(replayed, reader.seed());
+  replayed.hooks.playerEaten = onPlayerEaten;
+  replayed.hooks.playerLeft = onPlayerLeft;
+  broadcaster.reset();
+  times.tick.clear();
+  times.broadcast.clear();
+  times.events = 0;
+
+  unsigned long wallStart = wallMicros();
+  RecordedEvent event;
+  while (reader.next(event)) {
+    gameClock = event.time;
+    unsigned long start = wallMicros();
+    if (replayEvent(replayed, arena, filter, event)) {
+      unsigned long ticked = wallMicros();
+      times.tick.push_back(ticked - start);
+      if (broadcaster.tick(gameClock)) {
+        times.broadcast.push_back(wallMicros() - ticked);
+      }
+    }
+    times.events++;
+  }
+  times.sessionMs = gameClock;
+  times.wallMs = (wallMicros() - wallStart) / 1000.0;
+  return true;
+}
+
+static uint32_t percentile(std::vector<uint32_t>& v, int p) {
+  return v[(v.size() - 1) * p / 100];
+}
+
+static void report(const char* label, std::vector<uint32_t>& v) {
+  if (v.empty()) return;
+  std::sort(v.begin(), v.end());
+  char msg[200];
+  snprintf(msg, sizeof(msg), "%s: %u amostras, p50 %u us, p90 %u us, p99 %u us, max %u us",
+           label, (unsigned)v.size(), (unsigned)percentile(v, 50), (unsigned)percentile(v, 90),
+           (unsigned)percentile(v, 99), (unsigned)v.back());
+  TEST_MESSAGE(msg);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Gravado ao vivo e reproduzido num mundo novo: mesmo estado no fim
+void test_replay_is_deterministic() {
+  liveMicros = slowMicros;
+  runLiveSession(0xC0FFEE, 60);
+  liveMicros = wallMicros;
+
+  ReplayTimes times;
+  TEST_ASSERT_TRUE(replayFile(file, times));
+  TEST_ASSERT_EQUAL_UINT32(live.tickCount, replayed.tickCount);
+  TEST_ASSERT_EQUAL_UINT32(live.rngState, replayed.rngState);
+  TEST_ASSERT_EQUAL(live.playerCount, replayed.playerCount);
+  TEST_ASSERT_EQUAL_MEMORY(live.pellets, replayed.pellets, sizeof(live.pellets));
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    TEST_ASSERT_EQUAL(live.players[i].active, replayed.players[i].active);
+    if (!live.players[i].active) continue;
+    TEST_ASSERT_EQUAL_STRING(live.players[i].id, replayed.players[i].id);
+    TEST_ASSERT_EQUAL_MEMORY(&live.players[i].x, &replayed.players[i].x, sizeof(float));
+    TEST_ASSERT_EQUAL_MEMORY(&live.players[i].y, &replayed.players[i].y, sizeof(float));
+    TEST_ASSERT_EQUAL_MEMORY(&live.players[i].r, &replayed.players[i].r, sizeof(float));
+  }
+}
+
+// Segundo join na mesma conexão: o mesmo slot, com o nome novo; outra
+// conexão ocupa outro
+void test_second_join_reuses_slot() {
+  setupWorld(live, 1);
+  recorder.begin(1);
+  liveText(3, "{\"type\":\"join\",\"playerId\":\"4238\",\"name\":\"Ana\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"}");
+  int first = live.findClient(3);
+  liveText(3, "{\"type\":\"join\",\"playerId\":\"4238\",\"name\":\"Bia\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"}");
+  TEST_ASSERT_TRUE(first >= 0);
+  TEST_ASSERT_EQUAL(first, live.findClient(3));
+  TEST_ASSERT_EQUAL(1, live.playerCount);
+  TEST_ASSERT_EQUAL_STRING("Bia", live.players[first].name);
+
+  liveText(4, "{\"type\":\"join\",\"playerId\":\"77\",\"name\":\"Caio\",\"fillColor\":\"rgb(7,191,255)\",\"strokeColor\":\"rgb(6,162,217)\"}");
+  TEST_ASSERT_EQUAL(2, live.playerCount);
+  TEST_ASSERT_TRUE(live.findClient(4) != first);
+}
+
+// Sessão longa: percentis do tick e do broadcast reproduzidos
+void test_tick_percentiles() {
+  runLiveSession(0xBEEF, SESSION_SECONDS);
+
+  ReplayTimes times;
+  TEST_ASSERT_TRUE(replayFile(file, times));
+
+  char msg[200];
+  snprintf(msg, sizeof(msg), "reprodução: %u humanos + bots, %u eventos, %u bytes, %u s de sessão em %.0f ms",
+           HUMANS, (unsigned)times.events, (unsigned)file.size(), (unsigned)(times.sessionMs / 1000), times.wallMs);
+  TEST_MESSAGE(msg);
+  report("tick", times.tick);
+  report("broadcast", times.broadcast);
+  TEST_ASSERT_EQUAL(SESSION_SECONDS * 1000 / TICK_MS - 1, times.tick.size());
+}
+
+// Gravação real, baixada de /record (AGARIO_REPLAY=caminho)
+void test_replay_file() {
+  FILE* f = fopen(getenv("AGARIO_REPLAY"), "rb");
+  TEST_ASSERT_NOT_NULL(f);
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+  fclose(f);
+
+  ReplayTimes times;
+  TEST_ASSERT_TRUE(replayFile(data, times));
+  char msg[200];
+  snprintf(msg, sizeof(msg), "%s: semente %u, %u eventos, %u s de sessão em %.0f ms",
+           getenv("AGARIO_REPLAY"), (unsigned)replayed.seed, (unsigned)times.events,
+           (unsigned)(times.sessionMs / 1000), times.wallMs);
+  TEST_MESSAGE(msg);
+  report("tick", times.tick);
+  report("broadcast", times.broadcast);
+}
+
+int main() {
+  buildInputFilter(filter);
+  broadcaster.hooks.micros = wallMicros;
+  broadcaster.begin();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_is_deterministic);
+  RUN_TEST(test_second_join_reuses_slot);
+  RUN_TEST(test_tick_percentiles);
+  if (getenv("AGARIO_REPLAY")) {
+    RUN_TEST(test_replay_file);
+  }
+  return UNITY_END();
+}
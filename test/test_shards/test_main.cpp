@@ -0,0 +1,442 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "world.h"
+#include "shard.h"
+
+// Shards do agario (src/agario/shard.h) no host:
+//   - dois nós ligados por uma fila na memória: handoff com ack, reenvio,
+//     prazo esgotado e colisão com ghost (pedido ao dono da vítima)
+//   - vários processos em 127.0.0.1 trocando UDP, como os ESP32 no WiFi,
+//     com bots e jogadores guiados atravessando as faixas; cada processo
+//     informa o tempo do tick e a latência do handoff
+// Duração da rodada com processos: AGARIO_SHARD_SECONDS (padrão 10 s).
+
+#define HARNESS_SHARDS 3
+#define HARNESS_PORT 42100        // shard k escuta em HARNESS_PORT + k
+#define HARNESS_BOTS 4            // população de bots por shard
+#define HARNESS_DRIVEN 2          // jogadores guiados que começam em cada shard
+#define HARNESS_SECONDS 10
+
+static unsigned long clockMs = 0;
+static unsigned long manualClock() { return clockMs; }
+
+static unsigned long wallMicros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ---- Dois nós na memória ----
+
+static World worlds[2];
+static ShardNode* nodes[2];
+
+struct Packet {
+  int to;
+  std::vector<uint8_t> data;
+};
+
+static std::vector<Packet> queue;
+static int eatenOn[2];
+static uint8_t nextNum;           // uma conexão por jogador
+
+static void queueSend(int shard, const uint8_t* data, size_t len) {
+  Packet packet;
+  packet.to = shard;
+  packet.data.assign(data, data + len);
+  queue.push_back(packet);
+}
+
+// Entregar tudo (inclusive as respostas geradas na entrega)
+static void deliver() {
+  while (!queue.empty()) {
+    Packet packet = queue.front();
+    queue.erase(queue.begin());
+    nodes[packet.to]->receive(packet.data.data(), packet.data.size());
+  }
+}
+
+static void onEaten0(int, const char*, const char*) { eatenOn[0]++; }
+static void onEaten1(int, const char*, const char*) { eatenOn[1]++; }
+
+// Humanos que chegam entram direto, como se já tivessem reconectado
+static World* arrivingWorld;
+static bool joinArrived(const ShardHandoff& msg) {
+  int i = arrivingWorld->join(nextNum++, msg.state.id, msg.state.name, msg.state.fillColor, msg.state.strokeColor);
+  if (i < 0) return false;
+  arrivingWorld->players[i].x = msg.state.x;
+  arrivingWorld->players[i].y = msg.state.y;
+  arrivingWorld->players[i].r = msg.state.r;
+  return true;
+}
+
+static void resetPair() {
+  static ShardNode node0(worlds[0], 0, 2);
+  static ShardNode node1(worlds[1], 1, 2);
+  nodes[0] = &node0;
+  nodes[1] = &node1;
+  clockMs = 1000;
+  queue.clear();
+  eatenOn[0] = eatenOn[1] = 0;
+  nextNum = 0;
+  for (int s = 0; s < 2; s++) {
+    worlds[s].hooks.clock = manualClock;
+    worlds[s].botPopulation = 0;
+    nodes[s]->hooks.send = queueSend;
+    nodes[s]->hooks.millis = manualClock;
+    nodes[s]->begin();
+    worlds[s].reset(s + 1);
+    memset(&nodes[s]->stats, 0, sizeof(ShardStats));
+  }
+  worlds[0].hooks.playerEaten = onEaten0;
+  worlds[1].hooks.playerEaten = onEaten1;
+  arrivingWorld = &worlds[1];
+  nodes[1]->hooks.humanArrived = joinArrived;
+}
+
+static int place(int s, const char* id, float x, float y, float r, bool bot) {
+  int i = worlds[s].join(nextNum++, id, id, "rgb(7,191,255)", "rgb(6,162,217)");
+  worlds[s].players[i].x = x;
+  worlds[s].players[i].y = y;
+  worlds[s].players[i].r = r;
+  worlds[s].players[i].isBot = bot;
+  return i;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_bot_handoff() {
+  resetPair();
+  place(0, "bot0.1", 2500 + HANDOFF_MARGIN + 10, 1000, 30, true);
+
+  nodes[0]->tick();
+  deliver();
+  TEST_ASSERT_EQUAL(0, worlds[0].playerCount);
+  TEST_ASSERT_EQUAL(1, worlds[1].playerCount);
+  TEST_ASSERT_EQUAL_STRING("bot0.1", worlds[1].players[0].id);
+  TEST_ASSERT_TRUE(worlds[1].players[0].isBot);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 30, worlds[1].players[0].r);
+  TEST_ASSERT_EQUAL(1, nodes[0]->stats.handoffs);
+  TEST_ASSERT_EQUAL(1, nodes[1]->stats.received);
+}
+
+// Ack perdido: a origem reenvia, o destino reconhece o id e só repete o ack
+void test_handoff_lost_ack() {
+  resetPair();
+  place(0, "humano", 2500 + HANDOFF_MARGIN + 10, 1000, 30, false);
+
+  nodes[0]->tick();
+  TEST_ASSERT_EQUAL(1, (int)queue.size());
+  nodes[1]->receive(queue[0].data.data(), queue[0].data.size());
+  queue.clear();
+  TEST_ASSERT_EQUAL(1, worlds[1].playerCount);
+  TEST_ASSERT_EQUAL(1, worlds[0].playerCount);
+
+  clockMs += HANDOFF_RETRY_MS;
+  nodes[0]->tick();
+  deliver();
+  TEST_ASSERT_EQUAL(0, worlds[0].playerCount);
+  TEST_ASSERT_EQUAL(1, worlds[1].playerCount);
+  TEST_ASSERT_EQUAL(1, nodes[1]->stats.received);
+  TEST_ASSERT_EQUAL(HANDOFF_RETRY_MS, nodes[0]->stats.ackMillis);
+}
+
+// Vizinho mudo: depois de HANDOFF_TIMEOUT o jogador volta para a faixa
+void test_handoff_timeout() {
+  resetPair();
+  int i = place(0, "humano", 2500 + HANDOFF_MARGIN + 10, 1000, 30, false);
+
+  for (int t = 0; t <= HANDOFF_TIMEOUT / TICK_MS + 1; t++) {
+    nodes[0]->tick();
+    queue.clear();
+    clockMs += TICK_MS;
+  }
+  TEST_ASSERT_EQUAL(1, nodes[0]->stats.failed);
+  TEST_ASSERT_EQUAL(0, worlds[0].players[i].handoffId);
+  TEST_ASSERT_TRUE(worlds[0].players[i].x <= 2500 - 30);
+}
+
+// Célula grande em 0 sobre o ghost de uma pequena de 1: o dono da pequena
+// a come e devolve a massa
+void test_ghost_eat() {
+  resetPair();
+  int big = place(0, "grande", 2400, 1000, 200, false);
+  int small = place(1, "pequena", 2550, 1000, 20, false);
+
+  nodes[1]->broadcast();
+  deliver();
+  nodes[0]->tick();
+  deliver();
+
+  TEST_ASSERT_EQUAL(1, eatenOn[1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, CELL_MIN_RADIUS, worlds[1].players[small].r);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 200 + 20 * 0.8f, worlds[0].players[big].r);
+  TEST_ASSERT_EQUAL(1, nodes[0]->stats.ghostEats);
+  TEST_ASSERT_EQUAL(1, nodes[1]->stats.eatenRemote);
+}
+
+// A vítima já saiu de baixo quando o pedido chega: nada muda
+void test_ghost_eat_rejected() {
+  resetPair();
+  int big = place(0, "grande", 2400, 1000, 200, false);
+  int small = place(1, "pequena", 2550, 1000, 20, false);
+
+  nodes[1]->broadcast();
+  deliver();
+  worlds[1].players[small].x = 2900;
+  nodes[0]->tick();
+  deliver();
+
+  TEST_ASSERT_EQUAL(0, eatenOn[1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 20, worlds[1].players[small].r);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 200, worlds[0].players[big].r);
+}
+
+// ---- Processos em 127.0.0.1 ----
+
+struct ShardReport {
+  int shard;
+  uint32_t ticks;
+  uint32_t p50, p90, p99, maxMicros;
+  uint32_t handoffs;
+  uint32_t ackP50, ackMax;  // do envio até o slot liberado pelo ack, em us
+  uint32_t failed;
+  uint32_t received;
+  uint32_t ghostEats;
+  uint32_t players;
+  uint32_t humans;
+};
+
+static int linkSocket;
+static int portBase;
+static World world;
+static ShardNode* node;
+static unsigned long startMillis;
+static unsigned long handoffSince[MAX_PLAYERS];
+static std::vector<uint32_t> ackMicros;
+
+static unsigned long elapsedMillis() {
+  return (unsigned long)(wallMicros() / 1000 - startMillis);
+}
+
+static void udpSend(int shard, const uint8_t* data, size_t len) {
+  sockaddr_in to;
+  memset(&to, 0, sizeof(to));
+  to.sin_family = AF_INET;
+  to.sin_port = htons(portBase + shard);
+  to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sendto(linkSocket, data, len, 0, (sockaddr*)&to, sizeof(to));
+}
+
+// O jogador guiado reconecta no destino assim que chega; a direção da
+// travessia vai em mx (humanos não usam o campo)
+static bool driverArrived(const ShardHandoff& msg) {
+  int i = world.join(nextNum++, msg.state.id, msg.state.name, msg.state.fillColor, msg.state.strokeColor);
+  if (i < 0) return false;
+  world.players[i].x = msg.state.x;
+  world.players[i].y = msg.state.y;
+  world.players[i].r = msg.state.r;
+  world.players[i].spawnTick = world.tickCount;
+  world.players[i].mx = msg.fromShard < node->id() ? 1 : -1;
+  return true;
+}
+
+// O ShardNode conta a latência em ms; aqui ela é medida em us, do tick
+// que enviou o handoff até removePlayer() na chegada do ack
+static void noteHandoffs() {
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    if (!world.players[i].active || world.players[i].handoffId == 0) {
+      handoffSince[i] = 0;
+    } else if (handoffSince[i] == 0) {
+      handoffSince[i] = wallMicros();
+    }
+  }
+}
+
+static void onLeft(int i) {
+  if (world.players[i].handoffId != 0 && handoffSince[i] != 0) {
+    ackMicros.push_back(wallMicros() - handoffSince[i]);
+  }
+  handoffSince[i] = 0;
+}
+
+// Humanos guiados de borda a borda do mundo, um input por quadro a 60 Hz
+static void drive(uint32_t tick) {
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    Player& player = world.players[i];
+    if (!player.active || player.isBot || player.handoffId != 0) continue;
+    if (player.x < 200) player.mx = 1;
+    if (player.x > WORLD_SIZE - 200) player.mx = -1;
+    for (int f = 0; f < 3; f++) {
+      world.applyInput(i, tick * 3 + f + 1, player.mx, 0, 1 / 60.0f);
+    }
+  }
+}
+
+static ShardReport runShard(int id, int seconds) {
+  ShardNode shard(world, id, HARNESS_SHARDS);
+  node = &shard;
+  startMillis = wallMicros() / 1000;
+  world.hooks.clock = elapsedMillis;
+  world.hooks.micros = wallMicros;
+  world.hooks.playerLeft = onLeft;
+  world.botPopulation = HARNESS_BOTS + HARNESS_DRIVEN;
+  shard.hooks.send = udpSend;
+  shard.hooks.millis = elapsedMillis;
+  shard.hooks.humanArrived = driverArrived;
+  shard.begin();
+  world.reset(1000 + id);
+
+  // Guiados começam perto das bordas, indo na direção delas
+  for (int d = 0; d < HARNESS_DRIVEN; d++) {
+    char name[PLAYER_ID_SIZE];
+    snprintf(name, sizeof(name), "guiado%d.%d", id, d);
+    int i = world.join(nextNum++, name, name, "rgb(255,7,139)", "rgb(217,6,118)");
+    world.spawnPlayer(i);
+    bool right = (d % 2 == 0) ? id < HARNESS_SHARDS - 1 : id == 0;
+    world.players[i].x = right ? shard.maxX() - 150 : shard.minX() + 150;
+    world.players[i].mx = right ? 1 : -1;
+  }
+
+  std::vector<uint32_t> micros;
+  uint32_t tick = 0;
+  unsigned long lastTick = 0, lastGhosts = 0;
+  uint8_t packet[SHARD_MAX_PACKET];
+
+  while (elapsedMillis() < (unsigned long)seconds * 1000) {
+    ssize_t len;
+    while ((len = recv(linkSocket, packet, sizeof(packet), MSG_DONTWAIT)) > 0) {
+      shard.receive(packet, len);
+    }
+
+    if (elapsedMillis() - lastTick >= TICK_MS) {
+      lastTick = elapsedMillis();
+      unsigned long start = wallMicros();
+      drive(tick++);
+      world.tick(-1);
+      shard.tick();
+      micros.push_back(wallMicros() - start);
+      noteHandoffs();
+    }
+    if (elapsedMillis() - lastGhosts >= 100) {
+      lastGhosts = elapsedMillis();
+      shard.expireGhosts();
+      shard.broadcast();
+    }
+    usleep(200);
+  }
+  std::sort(micros.begin(), micros.end());
+
+  ShardReport report;
+  memset(&report, 0, sizeof(report));
+  report.shard = id;
+  report.ticks = micros.size();
+  if (!micros.empty()) {
+    report.p50 = micros[micros.size() / 2];
+    report.p90 = micros[micros.size() * 9 / 10];
+    report.p99 = micros[micros.size() * 99 / 100];
+    report.maxMicros = micros.back();
+  }
+  report.handoffs = shard.stats.handoffs;
+  std::sort(ackMicros.begin(), ackMicros.end());
+  if (!ackMicros.empty()) {
+    report.ackP50 = ackMicros[ackMicros.size() / 2];
+    report.ackMax = ackMicros.back();
+  }
+  report.failed = shard.stats.failed;
+  report.received = shard.stats.received;
+  report.ghostEats = shard.stats.ghostEats;
+  report.players = world.playerCount;
+  for (int i = 0; i < MAX_PLAYERS; i++) {
+    report.humans += world.players[i].active && !world.players[i].isBot;
+  }
+  return report;
+}
+
+void test_localhost_processes() {
+  const char* env = getenv("AGARIO_SHARD_SECONDS");
+  int seconds = env ? atoi(env) : HARNESS_SECONDS;
+  portBase = HARNESS_PORT + (getpid() % 100) * HARNESS_SHARDS;
+
+  int results[2];
+  TEST_ASSERT_EQUAL(0, pipe(results));
+
+  pid_t children[HARNESS_SHARDS];
+  for (int id = 0; id < HARNESS_SHARDS; id++) {
+    children[id] = fork();
+    TEST_ASSERT_TRUE(children[id] >= 0);
+    if (children[id] == 0) {
+      close(results[0]);
+      linkSocket = socket(AF_INET, SOCK_DGRAM, 0);
+      sockaddr_in addr;
+      memset(&addr, 0, sizeof(addr));
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(portBase + id);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (linkSocket < 0 || bind(linkSocket, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        _exit(2);
+      }
+      ShardReport report = runShard(id, seconds);
+      ssize_t written = write(results[1], &report, sizeof(report));
+      _exit(written == (ssize_t)sizeof(report) ? 0 : 3);
+    }
+  }
+  close(results[1]);
+
+  ShardReport reports[HARNESS_SHARDS];
+  int count = 0;
+  ShardReport report;
+  while (count < HARNESS_SHARDS && read(results[0], &report, sizeof(report)) == (ssize_t)sizeof(report)) {
+    reports[count++] = report;
+  }
+  close(results[0]);
+  for (int id = 0; id < HARNESS_SHARDS; id++) {
+    int status = 0;
+    waitpid(children[id], &status, 0);
+    TEST_ASSERT_TRUE(WIFEXITED(status));
+    TEST_ASSERT_EQUAL(0, WEXITSTATUS(status));
+  }
+  TEST_ASSERT_EQUAL(HARNESS_SHARDS, count);
+
+  uint32_t handoffs = 0, received = 0;
+  char msg[240];
+  for (int k = 0; k < count; k++) {
+    const ShardReport& r = reports[k];
+    snprintf(msg, sizeof(msg),
+             "shard %d: %u ticks, tick p50 %u us, p90 %u us, p99 %u us, max %u us; "
+             "handoffs %u (ack p50 %u us, max %u us), %u falhas, %u recebidos; "
+             "%u ghosts comidos; %u jogadores no fim (%u guiados)",
+             r.shard, (unsigned)r.ticks, (unsigned)r.p50, (unsigned)r.p90, (unsigned)r.p99,
+             (unsigned)r.maxMicros, (unsigned)r.handoffs,
+             (unsigned)r.ackP50, (unsigned)r.ackMax,
+             (unsigned)r.failed, (unsigned)r.received, (unsigned)r.ghostEats,
+             (unsigned)r.players, (unsigned)r.humans);
+    TEST_MESSAGE(msg);
+    handoffs += r.handoffs;
+    received += r.received;
+  }
+
+  // Todo handoff com ack foi aceito por alguém
+  TEST_ASSERT_TRUE(handoffs > 0);
+  TEST_ASSERT_TRUE(handoffs <= received);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bot_handoff);
+  RUN_TEST(test_handoff_lost_ack);
+  RUN_TEST(test_handoff_timeout);
+  RUN_TEST(test_ghost_eat);
+  RUN_TEST(test_ghost_eat_rejected);
+  RUN_TEST(test_localhost_processes);
+  return UNITY_END();
+}
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Visualizador da telemetria binária dos sketches do roomba.
+
+Lê a serial do Arduino ou do ESP32 (ou um arquivo gravado dela), decodifica
+os quadros de include/telemetria.h e imprime o status em texto. Bytes fora
+de quadros (mensagens da partida) passam direto.
+
+    python3 tools/telemetria.py /dev/ttyACM0
+    python3 tools/telemetria.py /dev/ttyUSB0 --baud 115200
+    python3 tools/telemetria.py captura.bin
+
+Os layouts abaixo têm que acompanhar os structs Registro* do header.
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = 0xA5
+MAX_PAYLOAD = 32
+
+TLM_ESTADO = 0x10
+TLM_LOOP = 0x11
+TLM_TAREFA = 0x12
+TLM_ENLACE = 0x13
+TLM_LATENCIA = 0x14
+TLM_RESPOSTA = 0x15
+
+ESTADOS = ["IDLE", "CLEAN", "DOCK", "CHRG"]
+ORIGENS = ["Arduino", "ESP32"]
+DISTANCIAS = ["Sem obstáculo", "Obstáculo longe", "Obstáculo meia distância", "Obstáculo perto"]
+FAIXAS_LOOP = ["<100us", "<500us", "<1ms", "<5ms", "<20ms", ">=20ms"]
+RESULTADOS = ["ok", "comando desconhecido", "faltam argumentos", "argumento inválido", "linha longa"]
+LATENCIAS = ["sonar -> quadro", "quadro -> reação"]
+
+# struct, campos (little-endian, como nos dois MCUs)
+FORMATOS = {
+    TLM_ESTADO: ("<IBBBBHHhhHH", "instante origem estado flags falhas_dht dist_cm ldr umidade temperatura idade_dht reservado"),
+    TLM_LOOP: ("<HH6HHHHBB", "voltas_hz loop_max h0 h1 h2 h3 h4 h5 emissao_ultima emissao_max descartados ocioso reservado"),
+    TLM_TAREFA: ("<B7sIII", "id nome execucoes atraso_medio atraso_max"),
+    TLM_ENLACE: ("<HHIIII", "enviados sem_espaco recebidos erros perdidos descartados"),
+    TLM_LATENCIA: ("<HHII", "eventos perdidos media max"),
+    TLM_RESPOSTA: ("<B7s", "resultado comando"),
+}
+
+
+def crc16(dados):
+    crc = 0xFFFF
+    for b in dados:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+class Decodificador:
+    """Mesma máquina do Decodificador de include/protocolo.h, em Python."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.erros = 0
+
+    def alimentar(self, dados):
+        """Devolve uma lista de ('texto', bytes) e ('quadro', tipo, seq, payload)."""
+        self.buf += dados
+        saida = []
+        while self.buf:
+            inicio = self.buf.find(SYNC)
+            if inicio < 0:
+                saida.append(("texto", bytes(self.buf)))
+                self.buf.clear()
+                break
+            if inicio > 0:
+                saida.append(("texto", bytes(self.buf[:inicio])))
+                del self.buf[:inicio]
+            if len(self.buf) < 4:
+                break
+            tamanho = self.buf[3]
+            if tamanho > MAX_PAYLOAD:
+                saida.append(("texto", bytes(self.buf[:1])))
+                del self.buf[:1]
+                continue
+            total = 6 + tamanho
+            if len(self.buf) < total:
+                break
+            quadro = self.buf[:total]
+            crc = quadro[-2] | (quadro[-1] << 8)
+            if crc != crc16(quadro[1:-2]):
+                # SYNC dentro do texto ou quadro corrompido: anda um byte
+                self.erros += 1
+                saida.append(("texto", bytes(self.buf[:1])))
+                del self.buf[:1]
+                continue
+            saida.append(("quadro", quadro[1], quadro[2], bytes(quadro[4:-2])))
+            del self.buf[:total]
+        return saida
+
+
+def campos(tipo, payload):
+    formato, nomes = FORMATOS[tipo]
+    if struct.calcsize(formato) != len(payload):
+        return None
+    return dict(zip(nomes.split(), struct.unpack(formato, payload)))
+
+
+class Visualizador:
+    def __init__(self, saida=sys.stdout):
+        self.saida = saida
+        self.origem = 0
+
+    def linha(self, texto=""):
+        self.saida.write(texto + "\n")
+
+    def quadro(self, tipo, payload):
+        if tipo not in FORMATOS:
+            return
+        r = campos(tipo, payload)
+        if r is None:
+            self.linha("(registro 0x%02x com tamanho inesperado: %d bytes)" % (tipo, len(payload)))
+            return
+        getattr(self, "registro_%02x" % tipo)(r)
+
+    def registro_10(self, r):
+        self.origem = r["origem"] & 1
+        flags = r["flags"]
+        self.linha("---------- STATUS %s (%d ms) ----------" % (ORIGENS[self.origem], r["instante"]))
+        self.linha("Estado do robô: %s" % (ESTADOS[r["estado"]] if r["estado"] < len(ESTADOS) else r["estado"]))
+        if flags & 0x20:
+            self.linha("Sensores: sem dados do Arduino")
+            return
+        self.linha("Distância: %s (%d cm)" % (DISTANCIAS[flags & 0x03], r["dist_cm"]))
+        self.linha("Luminosidade: %s (LDR %d)" % ("Obstáculo acima" if flags & 0x04 else "Sem obstáculo acima", r["ldr"]))
+        umidade = "Não aceitável" if flags & 0x08 else "Aceitável"
+        if flags & 0x10:
+            umidade += " (%.1f%%, %.1f C, há %d ms)" % (r["umidade"] / 10, r["temperatura"] / 10, r["idade_dht"])
+        if r["falhas_dht"]:
+            umidade += " falhas seguidas: %d" % r["falhas_dht"]
+        self.linha("Umidade: " + umidade)
+
+    def registro_11(self, r):
+        self.linha("Loop: %d Hz, máx %d us, ocioso %d%%" % (r["voltas_hz"], r["loop_max"], r["ocioso"]))
+        hist = [r["h%d" % k] for k in range(6)]
+        if any(hist):
+            self.linha("Voltas: " + " ".join("%s=%d" % (n, v) for n, v in zip(FAIXAS_LOOP, hist)))
+        self.linha("Emissão do status: %d us (máx %d us), %d registros descartados"
+                   % (r["emissao_ultima"], r["emissao_max"], r["descartados"]))
+
+    def registro_12(self, r):
+        nome = r["nome"].split(b"\0")[0].decode("ascii", "replace")
+        self.linha("  %-7s %4d execuções, atraso médio %d us, máx %d us"
+                   % (nome, r["execucoes"], r["atraso_medio"], r["atraso_max"]))
+
+    def registro_13(self, r):
+        self.linha("Enlace: %d enviados, %d sem espaço; recebidos %d, erros %d, perdidos %d, bytes descartados %d"
+                   % (r["enviados"], r["sem_espaco"], r["recebidos"], r["erros"], r["perdidos"], r["descartados"]))
+
+    def registro_14(self, r):
+        self.linha("Latência %s: %d eventos, média %d us, máx %d us, %d perdidos"
+                   % (LATENCIAS[self.origem], r["eventos"], r["media"], r["max"], r["perdidos"]))
+
+    def registro_15(self, r):
+        comando = r["comando"].split(b"\0")[0].decode("ascii", "replace")
+        resultado = RESULTADOS[r["resultado"]] if r["resultado"] < len(RESULTADOS) else r["resultado"]
+        self.linha("> %s: %s" % (comando, resultado))
+
+    def texto(self, dados):
+        self.saida.write(dados.decode("utf-8", "replace"))
+
+
+def abrir(caminho, baud):
+    if caminho == "-":
+        return sys.stdin.buffer, False
+    try:
+        open(caminho, "rb").close()
+        arquivo = not caminho.startswith("/dev/") and not caminho.upper().startswith("COM")
+    except OSError:
+        arquivo = False
+    if arquivo:
+        return open(caminho, "rb"), False
+    import serial  # pyserial
+    return serial.Serial(caminho, baud, timeout=0.1), True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("porta", help="porta serial, arquivo gravado ou - para stdin")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--gravar", help="salva os bytes crus recebidos neste arquivo")
+    args = parser.parse_args()
+
+    entrada, e_serial = abrir(args.porta, args.baud)
+    gravacao = open(args.gravar, "wb") if args.gravar else None
+    decodificador = Decodificador()
+    visualizador = Visualizador()
+
+    try:
+        while True:
+            dados = entrada.read(256)
+            if not dados:
+                if e_serial:
+                    continue
+                break
+            if gravacao:
+                gravacao.write(dados)
+            for item in decodificador.alimentar(dados):
+                if item[0] == "texto":
+                    visualizador.texto(item[1])
+                else:
+                    visualizador.quadro(item[1], item[3])
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if gravacao:
+            gravacao.close()
+
+
+if __name__ == "__main__":
+    main()